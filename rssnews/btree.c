@@ -0,0 +1,515 @@
+#include "btree.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+// target size of every node, chosen to span a handful of cache lines
+static const int kNodeBytes = 512;
+static const int kMinCapacity = 4;
+
+// leaves hold the client elements inline, right after the header, and
+// are chained together in ascending order
+typedef struct leafnode {
+	struct leafnode *next;
+	int count;
+} leafnode;
+
+// inner nodes hold count keys and count + 1 child pointers; the child
+// array comes first (right after the header) and the keys follow it
+typedef struct {
+	int count;
+} innernode;
+
+// keep the inline arrays pointer aligned
+#define kLeafHeader (((sizeof(leafnode) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+#define kInnerHeader (((sizeof(innernode) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+
+/**
+ * Invariant: every key stored in an inner node is a bytewise copy of the
+ * smallest element of the subtree to its right.  That means each element
+ * is copied into at most one inner node, and that copy can always be
+ * found on the way down as the key left of the last non-leftmost
+ * branch taken (the "separator slot").  BTreeEnter and BTreeDelete
+ * refresh that slot whenever the first element of a leaf changes, so a
+ * separator never outlives the element (and any memory it owns) that it
+ * was copied from.
+ */
+
+static void *LeafElem(const btree *t, const leafnode *leaf, int i)
+{
+	return (char *)leaf + kLeafHeader + i * t->elemSize;
+}
+
+static void **InnerChildren(const innernode *node)
+{
+	return (void **)((char *)node + kInnerHeader);
+}
+
+static void *InnerKey(const btree *t, const innernode *node, int i)
+{
+	return (char *)node + kInnerHeader + (t->innerCapacity + 1) * sizeof(void *) + i * t->elemSize;
+}
+
+static leafnode *LeafNew(const btree *t)
+{
+	leafnode *leaf = malloc(kLeafHeader + t->leafCapacity * t->elemSize);
+	assert(leaf != NULL);
+	leaf->next = NULL;
+	leaf->count = 0;
+	return leaf;
+}
+
+static innernode *InnerNew(const btree *t)
+{
+	innernode *node = malloc(kInnerHeader + (t->innerCapacity + 1) * sizeof(void *) +
+				 t->innerCapacity * t->elemSize);
+	assert(node != NULL);
+	node->count = 0;
+	return node;
+}
+
+void BTreeNew(btree *t, int elemSize, BTreeCompareFunction comparefn, BTreeFreeFunction freefn)
+{
+	assert(elemSize > 0);
+	assert(comparefn != NULL);
+
+	t->elemSize = elemSize;
+	t->elemCount = 0;
+	t->comparefn = comparefn;
+	t->freefn = freefn;
+
+	t->leafCapacity = (kNodeBytes - (int)kLeafHeader) / elemSize;
+	if (t->leafCapacity < kMinCapacity) t->leafCapacity = kMinCapacity;
+	t->innerCapacity = (kNodeBytes - (int)kInnerHeader - (int)sizeof(void *)) /
+		(elemSize + (int)sizeof(void *));
+	if (t->innerCapacity < kMinCapacity) t->innerCapacity = kMinCapacity;
+
+	t->root = LeafNew(t);
+	t->firstLeaf = t->root;
+	t->height = 0;
+}
+
+static void DisposeSubtree(btree *t, void *node, int level)
+{
+	if (level == 0) {
+		leafnode *leaf = node;
+		if (t->freefn != NULL) {
+			for (int i = 0; i < leaf->count; i++)
+				t->freefn(LeafElem(t, leaf, i));
+		}
+	} else {
+		innernode *inner = node;
+		for (int i = 0; i <= inner->count; i++)
+			DisposeSubtree(t, InnerChildren(inner)[i], level - 1);
+	}
+	free(node);
+}
+
+void BTreeDispose(btree *t)
+{
+	assert(t != NULL);
+
+	DisposeSubtree(t, t->root, t->height);
+	t->root = NULL;
+	t->firstLeaf = NULL;
+	t->elemCount = 0;
+}
+
+int BTreeCount(const btree *t)
+{
+	assert(t != NULL);
+
+	return t->elemCount;
+}
+
+// index of the first element in the leaf that isn't less than the key
+static int LeafLowerBound(const btree *t, const leafnode *leaf, const void *elemAddr)
+{
+	int low = 0, high = leaf->count;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (t->comparefn(LeafElem(t, leaf, mid), elemAddr) < 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+// index of the child whose subtree could contain the key: the number of
+// keys that are less than or equal to it
+static int InnerChildIndex(const btree *t, const innernode *node, const void *elemAddr)
+{
+	int low = 0, high = node->count;
+	while (low < high) {
+		int mid = (low + high) / 2;
+		if (t->comparefn(InnerKey(t, node, mid), elemAddr) <= 0)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+static leafnode *FindLeaf(const btree *t, const void *elemAddr)
+{
+	void *node = t->root;
+	for (int level = t->height; level > 0; level--)
+		node = InnerChildren(node)[InnerChildIndex(t, node, elemAddr)];
+	return node;
+}
+
+/**
+ * Inserts into the subtree rooted at node.  If the node had to be split,
+ * the new right sibling is returned through newNode, the key separating
+ * the two is copied into promotedKey, and true is returned.
+ */
+
+static bool InsertRecursive(btree *t, void *node, int level, const void *elemAddr,
+			    void *separator, void **newNode, void *promotedKey)
+{
+	int size = t->elemSize;
+
+	if (level == 0) {
+		leafnode *leaf = node;
+		int pos = LeafLowerBound(t, leaf, elemAddr);
+
+		if (pos < leaf->count && t->comparefn(LeafElem(t, leaf, pos), elemAddr) == 0) {
+			if (t->freefn != NULL) t->freefn(LeafElem(t, leaf, pos));
+			memcpy(LeafElem(t, leaf, pos), elemAddr, size);
+			if (pos == 0 && separator != NULL) memcpy(separator, elemAddr, size);
+			return false;
+		}
+
+		t->elemCount++;
+		if (leaf->count < t->leafCapacity) {
+			memmove(LeafElem(t, leaf, pos + 1), LeafElem(t, leaf, pos), (leaf->count - pos) * size);
+			memcpy(LeafElem(t, leaf, pos), elemAddr, size);
+			leaf->count++;
+			return false;
+		}
+
+		// full, so split the cap + 1 elements evenly across two leaves
+		leafnode *right = LeafNew(t);
+		int leftCount = (t->leafCapacity + 1) / 2;
+		if (pos < leftCount) {
+			right->count = t->leafCapacity - leftCount + 1;
+			memcpy(LeafElem(t, right, 0), LeafElem(t, leaf, leftCount - 1), right->count * size);
+			leaf->count = leftCount - 1;
+			memmove(LeafElem(t, leaf, pos + 1), LeafElem(t, leaf, pos), (leaf->count - pos) * size);
+			memcpy(LeafElem(t, leaf, pos), elemAddr, size);
+			leaf->count++;
+		} else {
+			int rightPos = pos - leftCount;
+			right->count = t->leafCapacity - leftCount + 1;
+			memcpy(LeafElem(t, right, 0), LeafElem(t, leaf, leftCount), rightPos * size);
+			memcpy(LeafElem(t, right, rightPos), elemAddr, size);
+			memcpy(LeafElem(t, right, rightPos + 1), LeafElem(t, leaf, pos), (t->leafCapacity - pos) * size);
+			leaf->count = leftCount;
+		}
+		right->next = leaf->next;
+		leaf->next = right;
+
+		*newNode = right;
+		memcpy(promotedKey, LeafElem(t, right, 0), size);
+		return true;
+	}
+
+	innernode *inner = node;
+	int i = InnerChildIndex(t, inner, elemAddr);
+	void *childSeparator = (i > 0) ? InnerKey(t, inner, i - 1) : separator;
+	void *childNew;
+	// the child's promoted key is consumed before this level writes its own,
+	// so the two can share the caller's buffer
+	char *childKey = promotedKey;
+
+	bool split = InsertRecursive(t, InnerChildren(inner)[i], level - 1, elemAddr,
+				     childSeparator, &childNew, childKey);
+	if (!split) return false;
+
+	if (inner->count < t->innerCapacity) {
+		void **children = InnerChildren(inner);
+		memmove(InnerKey(t, inner, i + 1), InnerKey(t, inner, i), (inner->count - i) * size);
+		memmove(&children[i + 2], &children[i + 1], (inner->count - i) * sizeof(void *));
+		memcpy(InnerKey(t, inner, i), childKey, size);
+		children[i + 1] = childNew;
+		inner->count++;
+		return false;
+	}
+
+	// full, so lay out all cap + 1 keys in scratch space and split around the middle one
+	int total = t->innerCapacity + 1;
+	char *keys = malloc(total * size);
+	void **children = malloc((total + 1) * sizeof(void *));
+	assert(keys != NULL && children != NULL);
+
+	memcpy(keys, InnerKey(t, inner, 0), i * size);
+	memcpy(keys + i * size, childKey, size);
+	memcpy(keys + (i + 1) * size, InnerKey(t, inner, i), (inner->count - i) * size);
+	memcpy(children, InnerChildren(inner), (i + 1) * sizeof(void *));
+	children[i + 1] = childNew;
+	memcpy(&children[i + 2], &InnerChildren(inner)[i + 1], (inner->count - i) * sizeof(void *));
+
+	int middle = total / 2;
+	innernode *right = InnerNew(t);
+
+	inner->count = middle;
+	memcpy(InnerKey(t, inner, 0), keys, middle * size);
+	memcpy(InnerChildren(inner), children, (middle + 1) * sizeof(void *));
+
+	right->count = total - middle - 1;
+	memcpy(InnerKey(t, right, 0), keys + (middle + 1) * size, right->count * size);
+	memcpy(InnerChildren(right), &children[middle + 1], (right->count + 1) * sizeof(void *));
+
+	memcpy(promotedKey, keys + middle * size, size);
+	*newNode = right;
+
+	free(keys);
+	free(children);
+	return true;
+}
+
+void BTreeEnter(btree *t, const void *elemAddr)
+{
+	assert(t != NULL);
+	assert(elemAddr != NULL);
+
+	void *newNode;
+	char smallKey[64];
+	char *promotedKey = (t->elemSize <= (int)sizeof(smallKey)) ? smallKey : malloc(t->elemSize);
+	assert(promotedKey != NULL);
+
+	if (InsertRecursive(t, t->root, t->height, elemAddr, NULL, &newNode, promotedKey)) {
+		// the root split, so the tree grows by one level
+		innernode *root = InnerNew(t);
+		root->count = 1;
+		InnerChildren(root)[0] = t->root;
+		InnerChildren(root)[1] = newNode;
+		memcpy(InnerKey(t, root, 0), promotedKey, t->elemSize);
+		t->root = root;
+		t->height++;
+	}
+	if (promotedKey != smallKey) free(promotedKey);
+}
+
+/**
+ * Restores the minimum occupancy of the child at index i of parent,
+ * either by borrowing one entry from an adjacent sibling that can spare
+ * it or by merging the child with a sibling.
+ */
+
+static void RebalanceChild(btree *t, innernode *parent, int i, int childLevel)
+{
+	int size = t->elemSize;
+	void **siblings = InnerChildren(parent);
+
+	if (childLevel == 0) {
+		int minCount = t->leafCapacity / 2;
+		leafnode *leaf = siblings[i];
+		leafnode *left = (i > 0) ? siblings[i - 1] : NULL;
+		leafnode *right = (i < parent->count) ? siblings[i + 1] : NULL;
+
+		if (left != NULL && left->count > minCount) {
+			memmove(LeafElem(t, leaf, 1), LeafElem(t, leaf, 0), leaf->count * size);
+			memcpy(LeafElem(t, leaf, 0), LeafElem(t, left, left->count - 1), size);
+			left->count--;
+			leaf->count++;
+			memcpy(InnerKey(t, parent, i - 1), LeafElem(t, leaf, 0), size);
+			return;
+		}
+		if (right != NULL && right->count > minCount) {
+			memcpy(LeafElem(t, leaf, leaf->count), LeafElem(t, right, 0), size);
+			leaf->count++;
+			right->count--;
+			memmove(LeafElem(t, right, 0), LeafElem(t, right, 1), right->count * size);
+			memcpy(InnerKey(t, parent, i), LeafElem(t, right, 0), size);
+			return;
+		}
+
+		// merge the right-hand leaf of the pair into the left-hand one
+		if (left != NULL) {
+			right = leaf;
+			leaf = left;
+			i--;
+		}
+		memcpy(LeafElem(t, leaf, leaf->count), LeafElem(t, right, 0), right->count * size);
+		leaf->count += right->count;
+		leaf->next = right->next;
+		free(right);
+	} else {
+		int minCount = t->innerCapacity / 2;
+		innernode *node = siblings[i];
+		innernode *left = (i > 0) ? siblings[i - 1] : NULL;
+		innernode *right = (i < parent->count) ? siblings[i + 1] : NULL;
+
+		if (left != NULL && left->count > minCount) {
+			// rotate right: the parent key comes down, left's last key goes up
+			memmove(InnerKey(t, node, 1), InnerKey(t, node, 0), node->count * size);
+			memmove(&InnerChildren(node)[1], &InnerChildren(node)[0], (node->count + 1) * sizeof(void *));
+			memcpy(InnerKey(t, node, 0), InnerKey(t, parent, i - 1), size);
+			InnerChildren(node)[0] = InnerChildren(left)[left->count];
+			node->count++;
+			memcpy(InnerKey(t, parent, i - 1), InnerKey(t, left, left->count - 1), size);
+			left->count--;
+			return;
+		}
+		if (right != NULL && right->count > minCount) {
+			// rotate left: the parent key comes down, right's first key goes up
+			memcpy(InnerKey(t, node, node->count), InnerKey(t, parent, i), size);
+			InnerChildren(node)[node->count + 1] = InnerChildren(right)[0];
+			node->count++;
+			memcpy(InnerKey(t, parent, i), InnerKey(t, right, 0), size);
+			memmove(InnerKey(t, right, 0), InnerKey(t, right, 1), (right->count - 1) * size);
+			memmove(&InnerChildren(right)[0], &InnerChildren(right)[1], right->count * sizeof(void *));
+			right->count--;
+			return;
+		}
+
+		if (left != NULL) {
+			right = node;
+			node = left;
+			i--;
+		}
+		memcpy(InnerKey(t, node, node->count), InnerKey(t, parent, i), size);
+		memcpy(InnerKey(t, node, node->count + 1), InnerKey(t, right, 0), right->count * size);
+		memcpy(&InnerChildren(node)[node->count + 1], InnerChildren(right), (right->count + 1) * sizeof(void *));
+		node->count += right->count + 1;
+		free(right);
+	}
+
+	// the pair (i, i + 1) was merged, so drop key i and child i + 1 from the parent
+	memmove(InnerKey(t, parent, i), InnerKey(t, parent, i + 1), (parent->count - i - 1) * size);
+	memmove(&siblings[i + 1], &siblings[i + 2], (parent->count - i - 1) * sizeof(void *));
+	parent->count--;
+}
+
+/**
+ * Deletes from the subtree rooted at node, and returns true if the node
+ * was left with fewer entries than the minimum occupancy.
+ */
+
+static bool DeleteRecursive(btree *t, void *node, int level, const void *elemAddr,
+			    void *separator, bool *found)
+{
+	if (level == 0) {
+		leafnode *leaf = node;
+		int pos = LeafLowerBound(t, leaf, elemAddr);
+
+		if (pos == leaf->count || t->comparefn(LeafElem(t, leaf, pos), elemAddr) != 0) {
+			*found = false;
+			return false;
+		}
+
+		*found = true;
+		if (t->freefn != NULL) t->freefn(LeafElem(t, leaf, pos));
+		leaf->count--;
+		memmove(LeafElem(t, leaf, pos), LeafElem(t, leaf, pos + 1), (leaf->count - pos) * t->elemSize);
+		t->elemCount--;
+
+		// non-root leaves never drop below two elements before a delete,
+		// so there's always a new first element to refresh the separator with
+		if (pos == 0 && separator != NULL)
+			memcpy(separator, LeafElem(t, leaf, 0), t->elemSize);
+
+		return leaf->count < t->leafCapacity / 2;
+	}
+
+	innernode *inner = node;
+	int i = InnerChildIndex(t, inner, elemAddr);
+	void *childSeparator = (i > 0) ? InnerKey(t, inner, i - 1) : separator;
+
+	if (DeleteRecursive(t, InnerChildren(inner)[i], level - 1, elemAddr, childSeparator, found))
+		RebalanceChild(t, inner, i, level - 1);
+
+	return inner->count < t->innerCapacity / 2;
+}
+
+bool BTreeDelete(btree *t, const void *elemAddr)
+{
+	assert(t != NULL);
+	assert(elemAddr != NULL);
+
+	bool found;
+	DeleteRecursive(t, t->root, t->height, elemAddr, NULL, &found);
+
+	// an inner root left with a single child hands the root role down to it
+	if (t->height > 0 && ((innernode *)t->root)->count == 0) {
+		void *onlyChild = InnerChildren(t->root)[0];
+		free(t->root);
+		t->root = onlyChild;
+		t->height--;
+	}
+	return found;
+}
+
+void *BTreeLookup(const btree *t, const void *elemAddr)
+{
+	assert(t != NULL);
+	assert(elemAddr != NULL);
+
+	leafnode *leaf = FindLeaf(t, elemAddr);
+	int pos = LeafLowerBound(t, leaf, elemAddr);
+
+	if (pos < leaf->count && t->comparefn(LeafElem(t, leaf, pos), elemAddr) == 0)
+		return LeafElem(t, leaf, pos);
+	return NULL;
+}
+
+void BTreeFirst(const btree *t, btreeiterator *it)
+{
+	assert(t != NULL && it != NULL);
+
+	it->tree = t;
+	it->leaf = t->firstLeaf;
+	it->index = 0;
+}
+
+void BTreeLowerBound(const btree *t, const void *elemAddr, btreeiterator *it)
+{
+	assert(t != NULL && it != NULL);
+	assert(elemAddr != NULL);
+
+	leafnode *leaf = FindLeaf(t, elemAddr);
+	it->tree = t;
+	it->leaf = leaf;
+	it->index = LeafLowerBound(t, leaf, elemAddr);
+}
+
+void *BTreeIteratorNext(btreeiterator *it)
+{
+	assert(it != NULL);
+
+	leafnode *leaf = it->leaf;
+	while (leaf != NULL && it->index == leaf->count) {
+		leaf = leaf->next;
+		it->index = 0;
+	}
+	it->leaf = leaf;
+	if (leaf == NULL) return NULL;
+
+	return LeafElem(it->tree, leaf, it->index++);
+}
+
+void BTreeMap(btree *t, BTreeMapFunction mapfn, void *auxData)
+{
+	BTreeMapRange(t, NULL, NULL, mapfn, auxData);
+}
+
+void BTreeMapRange(btree *t, const void *lowAddr, const void *highAddr,
+		   BTreeMapFunction mapfn, void *auxData)
+{
+	assert(t != NULL);
+	assert(mapfn != NULL);
+
+	btreeiterator it;
+	if (lowAddr != NULL)
+		BTreeLowerBound(t, lowAddr, &it);
+	else
+		BTreeFirst(t, &it);
+
+	void *elem;
+	while ((elem = BTreeIteratorNext(&it)) != NULL) {
+		if (highAddr != NULL && t->comparefn(elem, highAddr) >= 0) break;
+		mapfn(elem, auxData);
+	}
+}
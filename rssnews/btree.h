@@ -0,0 +1,214 @@
+#ifndef __btree_
+#define __btree_
+#include "bool.h"
+
+/* File: btree.h
+ * -------------
+ * Defines the interface for the btree, an ordered container
+ * implemented as a B+-tree.
+ *
+ * Like the hashset, the btree stores copies of client elements of
+ * any fixed size and relies on a client-supplied comparison function,
+ * but unlike the hashset it keeps the elements in sorted order.  That
+ * makes it appropriate for range and prefix queries ("every word
+ * starting with comput", "every article published in March") that
+ * the hashset can't answer, and unlike a sorted vector it accepts
+ * inserts and deletes in logarithmic time.
+ *
+ * Elements live directly inside the leaves (no per-element allocation),
+ * the leaves are chained together in sorted order, and every node is
+ * sized to a small number of cache lines, so a lookup touches only
+ * a handful of nodes and an in-order scan walks memory sequentially.
+ */
+
+/**
+ * Type: BTreeCompareFunction
+ * --------------------------
+ * Class of function designed to compare two elements, each identified
+ * by address.  The return value follows the strcmp convention:
+ * negative if the element at elemAddr1 sorts before the element at
+ * elemAddr2, zero if the two are equal, and positive otherwise.  The
+ * ordering must be consistent for the lifetime of the btree.
+ */
+
+typedef int (*BTreeCompareFunction)(const void *elemAddr1, const void *elemAddr2);
+
+/**
+ * Type: BTreeMapFunction
+ * ----------------------
+ * Class of function that can be mapped over the elements stored in a
+ * btree.  Each call receives the address of a client element and the
+ * auxData pointer passed to BTreeMap or BTreeMapRange.
+ */
+
+typedef void (*BTreeMapFunction)(void *elemAddr, void *auxData);
+
+/**
+ * Type: BTreeFreeFunction
+ * -----------------------
+ * Class of function designed to dispose of any resources embedded
+ * within the element at the specified address.  It's called on an
+ * element that's about to be replaced (BTreeEnter), removed (BTreeDelete)
+ * or discarded when the entire tree is disposed of (BTreeDispose).
+ */
+
+typedef void (*BTreeFreeFunction)(void *elemAddr);
+
+/**
+ * Type: btree
+ * -----------
+ * The concrete representation of the btree.  As with the hashset,
+ * the fields are exposed only because C gives us no easy way to hide
+ * them; the client is required to interact with the btree exclusively
+ * through the functions described below.
+ */
+
+typedef struct {
+  void *root;
+  void *firstLeaf;
+  int height;
+  int elemSize;
+  int elemCount;
+  int leafCapacity;
+  int innerCapacity;
+  BTreeCompareFunction comparefn;
+  BTreeFreeFunction freefn;
+} btree;
+
+/**
+ * Type: btreeiterator
+ * -------------------
+ * Identifies a position within a btree, as produced by BTreeFirst
+ * or BTreeLowerBound and advanced by BTreeIteratorNext.  An iterator is
+ * invalidated by any BTreeEnter or BTreeDelete on the same tree.
+ */
+
+typedef struct {
+  const btree *tree;
+  void *leaf;
+  int index;
+} btreeiterator;
+
+/**
+ * Function: BTreeNew
+ * ------------------
+ * Initializes the identified btree to be empty.  The elemSize parameter
+ * specifies the number of bytes each element occupies, the comparefn
+ * dictates the sort order, and the freefn (which may be NULL) is given a
+ * chance to clean up each element as it's replaced, deleted, or
+ * disposed of.
+ *
+ * An assert is raised unless elemSize is greater than 0 and comparefn is
+ * non-NULL.
+ */
+
+void BTreeNew(btree *t, int elemSize, BTreeCompareFunction comparefn, BTreeFreeFunction freefn);
+
+/**
+ * Function: BTreeDispose
+ * ----------------------
+ * Disposes of all resources acquired during the lifetime of the btree,
+ * applying the free function supplied to BTreeNew to every element.
+ */
+
+void BTreeDispose(btree *t);
+
+/**
+ * Function: BTreeCount
+ * --------------------
+ * Returns the number of elements residing in the specified btree.
+ */
+
+int BTreeCount(const btree *t);
+
+/**
+ * Function: BTreeEnter
+ * --------------------
+ * Inserts a copy of the element at elemAddr into the btree.  If an
+ * equal element (as far as the compare function is concerned) is already
+ * present, the old element is handed to the free function and replaced,
+ * just as HashSetEnter does.  Runs in O(log n) time.
+ */
+
+void BTreeEnter(btree *t, const void *elemAddr);
+
+/**
+ * Function: BTreeDelete
+ * ---------------------
+ * Removes the element matching the one at elemAddr, applying the free
+ * function to it first.  Returns true if an element was removed and
+ * false if no match was present.  Runs in O(log n) time.
+ */
+
+bool BTreeDelete(btree *t, const void *elemAddr);
+
+/**
+ * Function: BTreeLookup
+ * ---------------------
+ * Returns the address of the stored element matching the one at
+ * elemAddr, or NULL if there is no such element.  The returned address
+ * is invalidated by the next BTreeEnter or BTreeDelete.
+ */
+
+void *BTreeLookup(const btree *t, const void *elemAddr);
+
+/**
+ * Function: BTreeFirst
+ * --------------------
+ * Positions the iterator on the smallest element in the tree.
+ */
+
+void BTreeFirst(const btree *t, btreeiterator *it);
+
+/**
+ * Function: BTreeLowerBound
+ * -------------------------
+ * Positions the iterator on the first element that is not less than
+ * the key at elemAddr.  The key only needs to be comparable with the
+ * stored elements, so a prefix search is a BTreeLowerBound on the prefix
+ * followed by iteration until an element no longer matches it:
+ *
+ *     char *prefix = "comput";
+ *     btreeiterator it;
+ *     char **word;
+ *     BTreeLowerBound(&words, &prefix, &it);
+ *     while ((word = BTreeIteratorNext(&it)) != NULL &&
+ *            strncmp(*word, prefix, strlen(prefix)) == 0) {
+ *         printf("%s\n", *word);
+ *     }
+ */
+
+void BTreeLowerBound(const btree *t, const void *elemAddr, btreeiterator *it);
+
+/**
+ * Function: BTreeIteratorNext
+ * ---------------------------
+ * Returns the address of the element at the iterator's position and
+ * advances the iterator to the element after it, or returns NULL if
+ * the iterator has run off the end of the tree.
+ */
+
+void *BTreeIteratorNext(btreeiterator *it);
+
+/**
+ * Function: BTreeMap
+ * ------------------
+ * Applies mapfn to every element in ascending order.  An assert is
+ * raised if mapfn is NULL.
+ */
+
+void BTreeMap(btree *t, BTreeMapFunction mapfn, void *auxData);
+
+/**
+ * Function: BTreeMapRange
+ * -----------------------
+ * Applies mapfn, in ascending order, to every element that is not less
+ * than the element at lowAddr and is less than the element at highAddr.
+ * Either bound may be NULL, in which case the range is open on that side.
+ * An assert is raised if mapfn is NULL.
+ */
+
+void BTreeMapRange(btree *t, const void *lowAddr, const void *highAddr,
+		   BTreeMapFunction mapfn, void *auxData);
+
+#endif
@@ -0,0 +1,423 @@
+#include "charset.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <assert.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Every conversion is written once, as a function that walks the source
+ * and writes UTF-8 to out.  Called with out set to NULL, the same function
+ * only counts, so the result can be allocated at exactly the right size
+ * before a second call fills it in.  ASCII, which reads the same in every
+ * supported set, is skipped (or copied) a block at a time.
+ */
+
+typedef struct {
+  const char *label;
+  charset cs;
+} charsetlabel;
+
+static const charsetlabel kLabels[] = {
+  { "utf-8", kCharsetUTF8 }, { "utf8", kCharsetUTF8 }, { "unicode-1-1-utf-8", kCharsetUTF8 },
+  { "windows-1252", kCharsetWindows1252 }, { "cp1252", kCharsetWindows1252 },
+  { "x-cp1252", kCharsetWindows1252 }, { "iso-8859-1", kCharsetWindows1252 },
+  { "iso8859-1", kCharsetWindows1252 }, { "iso_8859-1", kCharsetWindows1252 },
+  { "latin1", kCharsetWindows1252 }, { "l1", kCharsetWindows1252 },
+  { "us-ascii", kCharsetWindows1252 }, { "ascii", kCharsetWindows1252 },
+  { "utf-16", kCharsetUTF16LE }, { "utf-16le", kCharsetUTF16LE }, { "utf-16be", kCharsetUTF16BE }
+};
+
+static const int kNumLabels = sizeof(kLabels) / sizeof(kLabels[0]);
+
+// Windows-1252's characters for 0x80-0x9F; from 0xA0 up, every byte is its own code point
+static const unsigned short kWindows1252C1[32] = {
+  0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+  0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+  0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+  0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178
+};
+
+static const int kReplacementCharacter = 0xFFFD;
+
+// an XML declaration's encoding has to turn up within this many bytes
+static const size_t kLongestXMLDeclaration = 256;
+
+static bool IsLabelSpace(char ch)
+{
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\f';
+}
+
+/**
+ * Returns the length of the run of ASCII characters at p, which has
+ * length bytes.  On x86-64, 64 bytes are checked at a time while they're
+ * all ASCII, and 16 at a time thereafter.
+ */
+
+static size_t AsciiLength(const unsigned char *p, size_t length)
+{
+  size_t i = 0;
+
+#ifdef __SSE2__
+  while (length - i >= 64) {
+    __m128i a = _mm_loadu_si128((const __m128i *) (p + i));
+    __m128i b = _mm_loadu_si128((const __m128i *) (p + i + 16));
+    __m128i c = _mm_loadu_si128((const __m128i *) (p + i + 32));
+    __m128i d = _mm_loadu_si128((const __m128i *) (p + i + 48));
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) != 0) break;
+    i += 64;
+  }
+  while (length - i >= 16) {
+    int high = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (p + i)));
+    if (high != 0) return i + __builtin_ctz(high);
+    i += 16;
+  }
+#endif
+
+  while (i < length && p[i] < 0x80) i++;
+  return i;
+}
+
+/**
+ * Returns the length of the well-formed UTF-8 sequence at p, which has
+ * available bytes, or 0 if the sequence is ill-formed (overlong, a
+ * surrogate, beyond U+10FFFF, or cut short).
+ */
+
+static int SequenceLength(const unsigned char *p, size_t available)
+{
+  int length;
+  unsigned char low = 0x80, high = 0xBF;
+
+  if (p[0] < 0x80) return 1;
+  if (p[0] >= 0xC2 && p[0] <= 0xDF) {
+    length = 2;
+  } else if (p[0] >= 0xE0 && p[0] <= 0xEF) {
+    length = 3;
+    if (p[0] == 0xE0) low = 0xA0;
+    if (p[0] == 0xED) high = 0x9F;
+  } else if (p[0] >= 0xF0 && p[0] <= 0xF4) {
+    length = 4;
+    if (p[0] == 0xF0) low = 0x90;
+    if (p[0] == 0xF4) high = 0x8F;
+  } else {
+    return 0;
+  }
+
+  if (available < (size_t) length || p[1] < low || p[1] > high) return 0;
+  for (int i = 2; i < length; i++)
+    if ((p[i] & 0xC0) != 0x80) return 0;
+  return length;
+}
+
+// writes cp's UTF-8 encoding to out, unless out is NULL, and returns its length
+static int EncodeUTF8(int cp, char *out)
+{
+  if (cp < 0x80) {
+    if (out != NULL) out[0] = cp;
+    return 1;
+  }
+  if (cp < 0x800) {
+    if (out != NULL) {
+      out[0] = 0xC0 | (cp >> 6);
+      out[1] = 0x80 | (cp & 0x3F);
+    }
+    return 2;
+  }
+  if (cp < 0x10000) {
+    if (out != NULL) {
+      out[0] = 0xE0 | (cp >> 12);
+      out[1] = 0x80 | ((cp >> 6) & 0x3F);
+      out[2] = 0x80 | (cp & 0x3F);
+    }
+    return 3;
+  }
+  if (out != NULL) {
+    out[0] = 0xF0 | (cp >> 18);
+    out[1] = 0x80 | ((cp >> 12) & 0x3F);
+    out[2] = 0x80 | ((cp >> 6) & 0x3F);
+    out[3] = 0x80 | (cp & 0x3F);
+  }
+  return 4;
+}
+
+int Windows1252CodePoint(unsigned char byte)
+{
+  return (byte >= 0x80 && byte < 0xA0) ? kWindows1252C1[byte - 0x80] : byte;
+}
+
+size_t ValidUTF8Length(const char *bytes, size_t length)
+{
+  assert(bytes != NULL || length == 0);
+
+  const unsigned char *p = (const unsigned char *) bytes;
+  size_t i = 0;
+  while (i < length) {
+    i += AsciiLength(p + i, length - i);
+    while (i < length && p[i] >= 0x80) {
+      int sequenceLength = SequenceLength(p + i, length - i);
+      if (sequenceLength == 0) return i;
+      i += sequenceLength;
+    }
+  }
+  return i;
+}
+
+// copies the length characters at in to out, unless out is NULL, and returns length
+static size_t CopyRun(const unsigned char *in, size_t length, char *out)
+{
+  if (out != NULL) memcpy(out, in, length);
+  return length;
+}
+
+// keeps every well-formed sequence of UTF-8 and replaces every stray byte with U+FFFD
+static size_t RepairUTF8(const unsigned char *in, size_t length, char *out)
+{
+  size_t i = 0, used = 0;
+  while (i < length) {
+    size_t run = ValidUTF8Length((const char *) in + i, length - i);
+    used += CopyRun(in + i, run, (out != NULL) ? out + used : NULL);
+    i += run;
+    if (i < length) {
+      used += EncodeUTF8(kReplacementCharacter, (out != NULL) ? out + used : NULL);
+      i++;
+    }
+  }
+  return used;
+}
+
+static size_t ConvertWindows1252(const unsigned char *in, size_t length, char *out)
+{
+  // the UTF-8 for every byte from 0x80 up, worked out once per document
+  char encodings[128][3];
+  unsigned char encodingLengths[128];
+  for (int b = 0x80; b <= 0xFF; b++) {
+    int cp = Windows1252CodePoint(b);
+    encodingLengths[b - 0x80] = EncodeUTF8(cp, encodings[b - 0x80]);
+  }
+
+  size_t i = 0, used = 0;
+  while (i < length) {
+    size_t run = AsciiLength(in + i, length - i);
+    used += CopyRun(in + i, run, (out != NULL) ? out + used : NULL);
+    for (i += run; i < length && in[i] >= 0x80; i++) {
+      int b = in[i] - 0x80;
+      if (out != NULL) memcpy(out + used, encodings[b], encodingLengths[b]);
+      used += encodingLengths[b];
+    }
+  }
+  return used;
+}
+
+static int UTF16Unit(const unsigned char *p, bool bigEndian)
+{
+  return bigEndian ? (p[0] << 8) | p[1] : (p[1] << 8) | p[0];
+}
+
+/**
+ * Converts UTF-16.  On x86-64, eight code units are checked at a time
+ * and, when they're all ASCII, narrowed to eight bytes in one step.
+ */
+
+static size_t ConvertUTF16(const unsigned char *in, size_t length, bool bigEndian, char *out)
+{
+  size_t i = 0, used = 0;
+
+  while (length - i >= 2) {
+#ifdef __SSE2__
+    const __m128i nonAscii = _mm_set1_epi16((short) 0xFF80);
+    const __m128i zero = _mm_setzero_si128();
+    while (length - i >= 16) {
+      __m128i units = _mm_loadu_si128((const __m128i *) (in + i));
+      if (bigEndian) units = _mm_or_si128(_mm_slli_epi16(units, 8), _mm_srli_epi16(units, 8));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, nonAscii), zero)) != 0xFFFF) break;
+      if (out != NULL) _mm_storel_epi64((__m128i *) (out + used), _mm_packus_epi16(units, units));
+      used += 8;
+      i += 16;
+    }
+    if (length - i < 2) break;
+#endif
+
+    int cp = UTF16Unit(in + i, bigEndian);
+    i += 2;
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+      int low = (length - i >= 2) ? UTF16Unit(in + i, bigEndian) : 0;
+      if (cp <= 0xDBFF && low >= 0xDC00 && low <= 0xDFFF) {
+        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+        i += 2;
+      } else {
+        cp = kReplacementCharacter;
+      }
+    }
+    used += EncodeUTF8(cp, (out != NULL) ? out + used : NULL);
+  }
+
+  if (i < length) used += EncodeUTF8(kReplacementCharacter, (out != NULL) ? out + used : NULL);
+  return used;
+}
+
+static size_t Convert(charset cs, const unsigned char *in, size_t length, char *out)
+{
+  switch (cs) {
+    case kCharsetUTF8: return RepairUTF8(in, length, out);
+    case kCharsetWindows1252: return ConvertWindows1252(in, length, out);
+    case kCharsetUTF16LE: return ConvertUTF16(in, length, false, out);
+    case kCharsetUTF16BE: return ConvertUTF16(in, length, true, out);
+    default: assert(false); return 0;
+  }
+}
+
+charset CharsetForLabel(const char *label, int length)
+{
+  assert(label != NULL && length >= 0);
+
+  while (length > 0 && IsLabelSpace(*label)) {
+    label++;
+    length--;
+  }
+  while (length > 0 && IsLabelSpace(label[length - 1])) length--;
+
+  for (int i = 0; i < kNumLabels; i++)
+    if ((size_t) length == strlen(kLabels[i].label) && strncasecmp(label, kLabels[i].label, length) == 0)
+      return kLabels[i].cs;
+  return kCharsetUnknown;
+}
+
+// returns the charset named by a byte order mark at the start of bytes, and sets *bomLength
+static charset CharsetFromBOM(const unsigned char *bytes, size_t length, size_t *bomLength)
+{
+  *bomLength = 0;
+  if (length >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF) {
+    *bomLength = 3;
+    return kCharsetUTF8;
+  }
+  if (length >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE) {
+    *bomLength = 2;
+    return kCharsetUTF16LE;
+  }
+  if (length >= 2 && bytes[0] == 0xFE && bytes[1] == 0xFF) {
+    *bomLength = 2;
+    return kCharsetUTF16BE;
+  }
+  return kCharsetUnknown;
+}
+
+// returns the charset named by the charset parameter of a content type, as in "text/html; charset=utf-8"
+static charset CharsetFromContentType(const char *contentType, bool *declared)
+{
+  for (const char *p = strchr(contentType, ';'); p != NULL; p = strchr(p + 1, ';')) {
+    const char *value = p + 1;
+    while (IsLabelSpace(*value)) value++;
+    if (strncasecmp(value, "charset", 7) != 0) continue;
+    value += 7;
+    while (IsLabelSpace(*value)) value++;
+    if (*value != '=') continue;
+    value++;
+    while (IsLabelSpace(*value)) value++;
+
+    char quote = (*value == '"' || *value == '\'') ? *value++ : ';';
+    const char *end = value;
+    while (*end != '\0' && *end != quote && *end != ';' && !IsLabelSpace(*end)) end++;
+    *declared = true;
+    return CharsetForLabel(value, end - value);
+  }
+  return kCharsetUnknown;
+}
+
+// returns the charset named by the encoding of an XML declaration at the start of bytes
+static charset CharsetFromXMLDeclaration(const unsigned char *bytes, size_t length, bool *declared)
+{
+  const char *p = (const char *) bytes;
+  if (length < 5 || memcmp(p, "<?xml", 5) != 0) return kCharsetUnknown;
+
+  const char *end = p + ((length < kLongestXMLDeclaration) ? length : kLongestXMLDeclaration);
+  for (const char *q = p + 5; q + 1 < end; q++) {
+    if (q[0] == '?' && q[1] == '>') {
+      end = q;
+      break;
+    }
+  }
+
+  static const char kEncoding[] = "encoding";
+  const int kEncodingLength = sizeof(kEncoding) - 1;
+  for (p += 5; end - p > kEncodingLength; p++) {
+    if (memcmp(p, kEncoding, kEncodingLength) != 0 || !IsLabelSpace(p[-1])) continue;
+    const char *value = p + kEncodingLength;
+    while (value < end && IsLabelSpace(*value)) value++;
+    if (value == end || *value != '=') continue;
+    value++;
+    while (value < end && IsLabelSpace(*value)) value++;
+    if (value == end || (*value != '"' && *value != '\'')) continue;
+
+    const char *close = memchr(value + 1, *value, end - value - 1);
+    if (close == NULL) return kCharsetUnknown;
+    *declared = true;
+    return CharsetForLabel(value + 1, close - value - 1);
+  }
+  return kCharsetUnknown;
+}
+
+// does the work of DetectCharset, and also reports whether any charset was named at all
+static charset Detect(const unsigned char *bytes, size_t length, const char *contentType,
+                      size_t *bomLength, bool *declared)
+{
+  *declared = false;
+  charset cs = CharsetFromBOM(bytes, length, bomLength);
+  if (cs != kCharsetUnknown) {
+    *declared = true;
+    return cs;
+  }
+  if (contentType != NULL) {
+    cs = CharsetFromContentType(contentType, declared);
+    if (*declared) return cs;
+  }
+
+  // a document whose declaration can be read as ASCII isn't in UTF-16, whatever it says
+  cs = CharsetFromXMLDeclaration(bytes, length, declared);
+  if (cs == kCharsetUTF16LE || cs == kCharsetUTF16BE) return kCharsetUTF8;
+  return cs;
+}
+
+charset DetectCharset(const char *bytes, size_t length, const char *contentType)
+{
+  assert(bytes != NULL || length == 0);
+
+  size_t bomLength;
+  bool declared;
+  return Detect((const unsigned char *) bytes, length, contentType, &bomLength, &declared);
+}
+
+size_t ConvertToUTF8(char **bytes, size_t length, const char *contentType)
+{
+  assert(bytes != NULL && (*bytes != NULL || length == 0));
+
+  size_t bomLength;
+  bool declared;
+  charset cs = Detect((const unsigned char *) *bytes, length, contentType, &bomLength, &declared);
+  if (cs == kCharsetUnknown && declared) return length;
+
+  const unsigned char *in = (const unsigned char *) *bytes + bomLength;
+  length -= bomLength;
+  if (cs == kCharsetUnknown || cs == kCharsetUTF8 || cs == kCharsetWindows1252) {
+    size_t valid = (cs == kCharsetWindows1252) ?
+      AsciiLength(in, length) : ValidUTF8Length((const char *) in, length);
+    if (valid == length) {
+      if (bomLength > 0) memmove(*bytes, in, length);
+      return length;
+    }
+    if (cs == kCharsetUnknown) cs = kCharsetWindows1252;
+  }
+
+  size_t convertedLength = Convert(cs, in, length, NULL);
+  char *converted = malloc(convertedLength + 1);
+  assert(converted != NULL);
+  Convert(cs, in, length, converted);
+  converted[convertedLength] = '\0';
+
+  free(*bytes);
+  *bytes = converted;
+  return convertedLength;
+}
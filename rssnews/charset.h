@@ -0,0 +1,111 @@
+#ifndef _charset_
+#define _charset_
+
+#include "bool.h"
+#include <stddef.h>
+
+/**
+ * File: charset.h
+ * ---------------
+ * Defines the conversion of fetched documents to UTF-8, which is what
+ * the tokenizers and the entity decoder expect.  A document's character
+ * set is taken from its byte order mark, its Content-Type header or its
+ * XML declaration, in that order.  Conversion is table-driven, and where
+ * SSE2 is available it skips over ASCII 64 bytes at a time (without SSE2,
+ * a byte at a time).  Either way, a document that's already valid UTF-8
+ * (or pure ASCII in any of the supported sets) costs one read and isn't
+ * copied at all.
+ */
+
+/**
+ * Type: charset
+ * -------------
+ * The character sets ConvertToUTF8 understands.  kCharsetUnknown stands
+ * for any other, and for "not declared".  As in browsers, ISO-8859-1 and
+ * US-ASCII are read as Windows-1252: the two only differ at 0x80-0x9F,
+ * which are control characters in ISO-8859-1 and never occur in real
+ * text, but which documents labelled ISO-8859-1 routinely use for
+ * Windows-1252's curly quotes and dashes.
+ */
+
+typedef enum {
+  kCharsetUnknown,
+  kCharsetUTF8,
+  kCharsetWindows1252,
+  kCharsetUTF16LE,
+  kCharsetUTF16BE
+} charset;
+
+/**
+ * Function: CharsetForLabel
+ * Usage: charset cs = CharsetForLabel("windows-1252", 12);
+ * ------------------------
+ * Returns the character set with the given name ("utf-8", "latin1",
+ * "cp1252", "utf-16le" and the other common aliases, in any case), or
+ * kCharsetUnknown if the name isn't one of them.  A bare "utf-16" is
+ * taken to be little-endian.
+ */
+
+charset CharsetForLabel(const char *label, int length);
+
+/**
+ * Function: DetectCharset
+ * Usage: charset cs = DetectCharset(body, bodyLength, urlconn.contentType);
+ * -----------------------
+ * Works out the character set of the length bytes at bytes: a byte order
+ * mark settles it, failing that the charset parameter of contentType
+ * (which may be NULL), and failing that the encoding named by an XML
+ * declaration at the very start of the document.  Returns kCharsetUnknown
+ * if none of them says, or if what they say isn't supported.
+ *
+ * An XML declaration that claims UTF-16 is taken to mean UTF-8, as HTML
+ * and XML encoding sniffing do: had the document really been in UTF-16,
+ * with no byte order mark, its declaration couldn't have been read.
+ */
+
+charset DetectCharset(const char *bytes, size_t length, const char *contentType);
+
+/**
+ * Function: ValidUTF8Length
+ * Usage: if (ValidUTF8Length(bytes, length) == length) ...
+ * -------------------------
+ * Returns the length of the longest prefix of the length bytes at bytes
+ * that's well-formed UTF-8 (no overlong forms, surrogates or sequences cut
+ * short), which is length itself if they all are.
+ */
+
+size_t ValidUTF8Length(const char *bytes, size_t length);
+
+/**
+ * Function: Windows1252CodePoint
+ * Usage: int cp = Windows1252CodePoint(0x93);
+ * ------------------------------
+ * Returns the Unicode code point of the Windows-1252 character with the
+ * given byte value (0x20AC, the euro sign, for 0x80; 0x201C for 0x93).
+ * Bytes below 0x80 and from 0xA0 up are their own code points, as are
+ * the five (0x81, 0x8D, 0x8F, 0x90 and 0x9D) Windows-1252 leaves unused.
+ */
+
+int Windows1252CodePoint(unsigned char byte);
+
+/**
+ * Function: ConvertToUTF8
+ * Usage: bodyLength = ConvertToUTF8(&body, bodyLength, urlconn.contentType);
+ * -----------------------
+ * Converts the length bytes at *bytes, which must have been allocated
+ * with malloc, to UTF-8 and returns the new length.  The character set is
+ * determined by DetectCharset; an undeclared document is taken to be
+ * UTF-8 if it's valid UTF-8, and Windows-1252 if it isn't.  Any byte order
+ * mark is dropped, and anything ill-formed in the source (stray bytes in
+ * UTF-8, unpaired surrogates in UTF-16) becomes U+FFFD.  Documents in an
+ * unsupported character set are left alone.
+ *
+ * Valid UTF-8 stays where it is: *bytes is untouched, save that a byte
+ * order mark is removed by moving the rest down.  Anything else is
+ * converted into a new block, followed by a '\0' that isn't counted in
+ * the length, which replaces *bytes; the old block is freed.
+ */
+
+size_t ConvertToUTF8(char **bytes, size_t length, const char *contentType);
+
+#endif
@@ -0,0 +1,81 @@
+#include "fingerprintset.h"
+#include <assert.h>
+#include <stdlib.h>
+
+/**
+ * Fingerprints are hashes already, so the low bits of one pick its home
+ * slot directly, and collisions are resolved by linear probing.  0 can't
+ * be told apart from an empty slot, so it's recorded by a flag instead.
+ */
+
+static const size_t kMinSlots = 16;
+
+// the number of slots needed to hold count fingerprints at most three quarters full
+static size_t SlotsFor(size_t count)
+{
+  size_t numSlots = kMinSlots;
+  while (numSlots / 4 * 3 < count) numSlots *= 2;
+  return numSlots;
+}
+
+static uint64_t *FindSlot(uint64_t *slots, size_t numSlots, uint64_t fingerprint)
+{
+  size_t mask = numSlots - 1;
+  size_t i = fingerprint & mask;
+  while (slots[i] != 0 && slots[i] != fingerprint) i = (i + 1) & mask;
+  return &slots[i];
+}
+
+static void Rehash(fingerprintset *s, size_t numSlots)
+{
+  uint64_t *slots = calloc(numSlots, sizeof(uint64_t));
+  assert(slots != NULL);
+  for (size_t i = 0; i < s->numSlots; i++)
+    if (s->slots[i] != 0) *FindSlot(slots, numSlots, s->slots[i]) = s->slots[i];
+  free(s->slots);
+  s->slots = slots;
+  s->numSlots = numSlots;
+}
+
+void FingerprintSetNew(fingerprintset *s, size_t expectedCount)
+{
+  assert(s != NULL);
+  s->numSlots = SlotsFor(expectedCount);
+  s->slots = calloc(s->numSlots, sizeof(uint64_t));
+  assert(s->slots != NULL);
+  s->count = 0;
+  s->hasZero = false;
+}
+
+void FingerprintSetDispose(fingerprintset *s)
+{
+  free(s->slots);
+}
+
+size_t FingerprintSetCount(const fingerprintset *s)
+{
+  return s->count;
+}
+
+bool FingerprintSetEnter(fingerprintset *s, uint64_t fingerprint)
+{
+  if (fingerprint == 0) {
+    if (s->hasZero) return false;
+    s->hasZero = true;
+    s->count++;
+    return true;
+  }
+
+  uint64_t *slot = FindSlot(s->slots, s->numSlots, fingerprint);
+  if (*slot == fingerprint) return false;
+  *slot = fingerprint;
+  s->count++;
+  if (s->count > s->numSlots / 4 * 3) Rehash(s, 2 * s->numSlots);
+  return true;
+}
+
+bool FingerprintSetContains(const fingerprintset *s, uint64_t fingerprint)
+{
+  if (fingerprint == 0) return s->hasZero;
+  return *FindSlot(s->slots, s->numSlots, fingerprint) == fingerprint;
+}
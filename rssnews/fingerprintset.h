@@ -0,0 +1,82 @@
+#ifndef __fingerprintset_
+#define __fingerprintset_
+#include "bool.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* File: fingerprintset.h
+ * ----------------------
+ * Defines the interface for the fingerprintset, a set of 64-bit
+ * fingerprints such as URLFingerprint produces, meant for remembering
+ * which pages have already been fetched or indexed.
+ *
+ * The fingerprints are kept in one open-addressed table, eight bytes
+ * apiece and never more than three quarters full, so a set of a million
+ * URLs fits in 16MB at worst.  Keeping the URLs themselves as strdup'd
+ * char *s in a hashset costs a heap block and a bucket slot per URL on
+ * top of the (typically 60 to 100) characters of the URL.
+ *
+ * Like the hashset, a fingerprintset does no locking of its own: threads
+ * that share one must serialize their calls.
+ */
+
+/**
+ * Type: fingerprintset
+ * --------------------
+ * The concrete representation of the fingerprintset.  The client should
+ * treat every field as private and go through the functions below.
+ */
+
+typedef struct {
+  uint64_t *slots;    // 0 marks an empty slot
+  size_t numSlots;    // always a power of two
+  size_t count;
+  bool hasZero;       // whether 0 itself is in the set
+} fingerprintset;
+
+/**
+ * Function: FingerprintSetNew
+ * ---------------------------
+ * Initializes the specified fingerprintset to be empty, with room for
+ * expectedCount fingerprints before it needs to grow.  Pass 0 if there's
+ * no telling.
+ */
+
+void FingerprintSetNew(fingerprintset *s, size_t expectedCount);
+
+/**
+ * Function: FingerprintSetDispose
+ * -------------------------------
+ * Releases all memory owned by the fingerprintset.
+ */
+
+void FingerprintSetDispose(fingerprintset *s);
+
+/**
+ * Function: FingerprintSetCount
+ * -----------------------------
+ * Returns the number of distinct fingerprints residing in the set.
+ */
+
+size_t FingerprintSetCount(const fingerprintset *s);
+
+/**
+ * Function: FingerprintSetEnter
+ * Usage: if (FingerprintSetEnter(&seen, URLFingerprint(&link))) Fetch(&link);
+ * -----------------------------
+ * Adds the fingerprint to the set, and returns true if it wasn't there
+ * already, so that testing and recording a URL as seen is a single
+ * probe of the table.
+ */
+
+bool FingerprintSetEnter(fingerprintset *s, uint64_t fingerprint);
+
+/**
+ * Function: FingerprintSetContains
+ * --------------------------------
+ * Returns true if the fingerprint is in the set.
+ */
+
+bool FingerprintSetContains(const fingerprintset *s, uint64_t fingerprint);
+
+#endif
@@ -0,0 +1,379 @@
+#include "frontier.h"
+#include "hashset.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * Each server gets a frontierhost, found through a hashset keyed by the
+ * server's name and kept for as long as the frontier lives, so that its
+ * policy and the time of its last fetch outlast its queue.  The queue is
+ * itself a heap, ordered by priority and then by the order the urls were
+ * added in.
+ *
+ * A server with urls queued and a connection to spare sits in exactly
+ * one of two heaps: ready, if its delay has run out, and waiting if it
+ * hasn't.  Servers with nothing queued, or with all of their connections
+ * in use, sit in neither until FrontierAdd or FrontierDone changes that.
+ * Servers move from waiting to ready lazily, as FrontierNext finds their
+ * time has come.
+ */
+
+typedef struct {
+  url address;
+  int priority;
+  unsigned long sequence;
+} frontierentry;
+
+enum { kInNoHeap, kInReady, kInWaiting };
+
+typedef struct {
+  char *name;
+  frontierentry *queue;
+  int queueCount;
+  int queueCapacity;
+  int maxConnections;
+  int delay;
+  int active;
+  int64_t nextFetch;      // nanoseconds on CLOCK_MONOTONIC
+  int heap;               // kInNoHeap, kInReady or kInWaiting
+  int heapIndex;
+} frontierhost;
+
+typedef bool (*HostBeforeFunction)(const frontierhost *a, const frontierhost *b);
+
+typedef struct {
+  frontierhost **hosts;
+  int count;
+  int capacity;
+  HostBeforeFunction before;
+  int which;
+} hostheap;
+
+typedef struct {
+  hashset byName;         // of frontierhost *
+  hostheap ready;
+  hostheap waiting;
+  unsigned long sequence;
+} scheduler;
+
+static const int kNumHostBuckets = 1009;
+
+static int64_t Now(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static int HashHost(const void *elemAddr, int numBuckets)
+{
+  const frontierhost *host = *(frontierhost * const *) elemAddr;
+  unsigned long hash = 5381;
+  for (const char *p = host->name; *p != '\0'; p++)
+    hash = 33 * hash + tolower((unsigned char) *p);
+  return hash % numBuckets;
+}
+
+static int CompareHosts(const void *elemAddr1, const void *elemAddr2)
+{
+  return strcasecmp((*(frontierhost * const *) elemAddr1)->name, (*(frontierhost * const *) elemAddr2)->name);
+}
+
+static void FreeHost(void *elemAddr)
+{
+  frontierhost *host = *(frontierhost **) elemAddr;
+  for (int i = 0; i < host->queueCount; i++) URLDispose(&host->queue[i].address);
+  free(host->queue);
+  free(host->name);
+  free(host);
+}
+
+/**
+ * Queue order: higher priority first, and then first come, first served.
+ */
+
+static bool EntryBefore(const frontierentry *a, const frontierentry *b)
+{
+  if (a->priority != b->priority) return a->priority > b->priority;
+  return a->sequence < b->sequence;
+}
+
+static void QueuePush(frontierhost *host, const frontierentry *entry)
+{
+  if (host->queueCount == host->queueCapacity) {
+    host->queueCapacity = 2 * host->queueCapacity + 4;
+    host->queue = realloc(host->queue, host->queueCapacity * sizeof(frontierentry));
+    assert(host->queue != NULL);
+  }
+
+  int i = host->queueCount++;
+  while (i > 0 && EntryBefore(entry, &host->queue[(i - 1) / 2])) {
+    host->queue[i] = host->queue[(i - 1) / 2];
+    i = (i - 1) / 2;
+  }
+  host->queue[i] = *entry;
+}
+
+static frontierentry QueuePop(frontierhost *host)
+{
+  frontierentry top = host->queue[0];
+  frontierentry last = host->queue[--host->queueCount];
+  int i = 0, n = host->queueCount;
+  while (true) {
+    int child = 2 * i + 1;
+    if (child >= n) break;
+    if (child + 1 < n && EntryBefore(&host->queue[child + 1], &host->queue[child])) child++;
+    if (!EntryBefore(&host->queue[child], &last)) break;
+    host->queue[i] = host->queue[child];
+    i = child;
+  }
+  if (n > 0) host->queue[i] = last;
+  return top;
+}
+
+/**
+ * Ready servers are ordered by their best url, and then by how long
+ * they've been fetchable; waiting servers by when they will be.
+ */
+
+static bool ReadyBefore(const frontierhost *a, const frontierhost *b)
+{
+  const frontierentry *x = &a->queue[0], *y = &b->queue[0];
+  if (x->priority != y->priority) return x->priority > y->priority;
+  if (a->nextFetch != b->nextFetch) return a->nextFetch < b->nextFetch;
+  return x->sequence < y->sequence;
+}
+
+static bool WaitingBefore(const frontierhost *a, const frontierhost *b)
+{
+  return a->nextFetch < b->nextFetch;
+}
+
+// places host at index i of the heap, recording where it went
+static void HeapPlace(hostheap *h, frontierhost *host, int i)
+{
+  h->hosts[i] = host;
+  host->heapIndex = i;
+}
+
+static void HeapSift(hostheap *h, int i)
+{
+  frontierhost *host = h->hosts[i];
+  while (i > 0 && h->before(host, h->hosts[(i - 1) / 2])) {
+    HeapPlace(h, h->hosts[(i - 1) / 2], i);
+    i = (i - 1) / 2;
+  }
+  while (true) {
+    int child = 2 * i + 1;
+    if (child >= h->count) break;
+    if (child + 1 < h->count && h->before(h->hosts[child + 1], h->hosts[child])) child++;
+    if (!h->before(h->hosts[child], host)) break;
+    HeapPlace(h, h->hosts[child], i);
+    i = child;
+  }
+  HeapPlace(h, host, i);
+}
+
+static void HeapPush(hostheap *h, frontierhost *host)
+{
+  if (h->count == h->capacity) {
+    h->capacity = 2 * h->capacity + 16;
+    h->hosts = realloc(h->hosts, h->capacity * sizeof(frontierhost *));
+    assert(h->hosts != NULL);
+  }
+  host->heap = h->which;
+  HeapPlace(h, host, h->count++);
+  HeapSift(h, host->heapIndex);
+}
+
+static void HeapRemove(hostheap *h, frontierhost *host)
+{
+  int i = host->heapIndex;
+  host->heap = kInNoHeap;
+  frontierhost *last = h->hosts[--h->count];
+  if (i == h->count) return;
+  HeapPlace(h, last, i);
+  HeapSift(h, i);
+}
+
+/**
+ * Takes the host out of whichever heap it's in, and puts it back in the
+ * right one, if any, for its current state.
+ */
+
+static void Reschedule(scheduler *s, frontierhost *host, int64_t now)
+{
+  if (host->heap == kInReady) HeapRemove(&s->ready, host);
+  else if (host->heap == kInWaiting) HeapRemove(&s->waiting, host);
+
+  if (host->queueCount == 0 || host->active >= host->maxConnections) return;
+  HeapPush(host->nextFetch <= now ? &s->ready : &s->waiting, host);
+}
+
+static frontierhost *FindHost(scheduler *s, const char *name)
+{
+  frontierhost key;
+  key.name = (char *) name;
+  frontierhost *keyAddr = &key;
+  frontierhost **found = HashSetLookup(&s->byName, &keyAddr);
+  return (found != NULL) ? *found : NULL;
+}
+
+static frontierhost *FindOrAddHost(frontier *f, const char *name)
+{
+  scheduler *s = f->hosts;
+  frontierhost *host = FindHost(s, name);
+  if (host != NULL) return host;
+
+  host = calloc(1, sizeof(frontierhost));
+  assert(host != NULL);
+  host->name = strdup(name);
+  assert(host->name != NULL);
+  host->maxConnections = f->maxConnections;
+  host->delay = f->delay;
+  host->heap = kInNoHeap;
+  HashSetEnter(&s->byName, &host);
+  return host;
+}
+
+void FrontierNew(frontier *f, int maxConnections, int delay)
+{
+  assert(f != NULL && maxConnections > 0 && delay >= 0);
+
+  scheduler *s = calloc(1, sizeof(scheduler));
+  assert(s != NULL);
+  HashSetNew(&s->byName, sizeof(frontierhost *), kNumHostBuckets, HashHost, CompareHosts, FreeHost);
+  s->ready.before = ReadyBefore;
+  s->ready.which = kInReady;
+  s->waiting.before = WaitingBefore;
+  s->waiting.which = kInWaiting;
+  f->hosts = s;
+
+  // waits are timed against the monotonic clock, so changes to the date don't disturb them
+  pthread_condattr_t attributes;
+  pthread_condattr_init(&attributes);
+  pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+  pthread_cond_init(&f->changed, &attributes);
+  pthread_condattr_destroy(&attributes);
+  pthread_mutex_init(&f->lock, NULL);
+
+  f->maxConnections = maxConnections;
+  f->delay = delay;
+  f->count = 0;
+  f->closed = false;
+}
+
+void FrontierDispose(frontier *f)
+{
+  scheduler *s = f->hosts;
+  HashSetDispose(&s->byName);
+  free(s->ready.hosts);
+  free(s->waiting.hosts);
+  free(s);
+  pthread_cond_destroy(&f->changed);
+  pthread_mutex_destroy(&f->lock);
+}
+
+void FrontierSetHostPolicy(frontier *f, const char *serverName, int maxConnections, int delay)
+{
+  assert(serverName != NULL && maxConnections > 0 && delay >= 0);
+
+  pthread_mutex_lock(&f->lock);
+  frontierhost *host = FindOrAddHost(f, serverName);
+  host->maxConnections = maxConnections;
+  host->delay = delay;
+  Reschedule(f->hosts, host, Now());
+  pthread_cond_broadcast(&f->changed);
+  pthread_mutex_unlock(&f->lock);
+}
+
+void FrontierAdd(frontier *f, const url *u, int priority)
+{
+  assert(u != NULL && u->serverName != NULL);
+
+  pthread_mutex_lock(&f->lock);
+  assert(!f->closed);
+  scheduler *s = f->hosts;
+  frontierhost *host = FindOrAddHost(f, u->serverName);
+  frontierentry entry = { *u, priority, s->sequence++ };
+  QueuePush(host, &entry);
+  f->count++;
+  Reschedule(s, host, Now());
+  pthread_cond_broadcast(&f->changed);
+  pthread_mutex_unlock(&f->lock);
+}
+
+bool FrontierNext(frontier *f, url *u)
+{
+  assert(u != NULL);
+
+  pthread_mutex_lock(&f->lock);
+  scheduler *s = f->hosts;
+  while (true) {
+    int64_t now = Now();
+    while (s->waiting.count > 0 && s->waiting.hosts[0]->nextFetch <= now) {
+      frontierhost *host = s->waiting.hosts[0];
+      HeapRemove(&s->waiting, host);
+      HeapPush(&s->ready, host);
+    }
+
+    if (s->ready.count > 0) {
+      frontierhost *host = s->ready.hosts[0];
+      *u = QueuePop(host).address;
+      f->count--;
+      host->active++;
+      host->nextFetch = now + (int64_t) host->delay * 1000000;
+      Reschedule(s, host, now);
+      pthread_mutex_unlock(&f->lock);
+      return true;
+    }
+
+    if (f->closed && f->count == 0) break;
+    if (s->waiting.count > 0) {
+      int64_t wake = s->waiting.hosts[0]->nextFetch;
+      struct timespec until = { wake / 1000000000, wake % 1000000000 };
+      pthread_cond_timedwait(&f->changed, &f->lock, &until);
+    } else {
+      pthread_cond_wait(&f->changed, &f->lock);
+    }
+  }
+
+  pthread_mutex_unlock(&f->lock);
+  return false;
+}
+
+void FrontierDone(frontier *f, const url *u)
+{
+  assert(u != NULL && u->serverName != NULL);
+
+  pthread_mutex_lock(&f->lock);
+  frontierhost *host = FindHost(f->hosts, u->serverName);
+  assert(host != NULL && host->active > 0);
+  host->active--;
+  int64_t now = Now(), earliest = now + (int64_t) host->delay * 1000000;
+  if (host->nextFetch < earliest) host->nextFetch = earliest;
+  Reschedule(f->hosts, host, now);
+  pthread_cond_broadcast(&f->changed);
+  pthread_mutex_unlock(&f->lock);
+}
+
+void FrontierClose(frontier *f)
+{
+  pthread_mutex_lock(&f->lock);
+  f->closed = true;
+  pthread_cond_broadcast(&f->changed);
+  pthread_mutex_unlock(&f->lock);
+}
+
+int FrontierCount(frontier *f)
+{
+  pthread_mutex_lock(&f->lock);
+  int count = f->count;
+  pthread_mutex_unlock(&f->lock);
+  return count;
+}
@@ -0,0 +1,136 @@
+#ifndef __frontier_
+#define __frontier_
+#include "bool.h"
+#include "url.h"
+#include <pthread.h>
+
+/* File: frontier.h
+ * ----------------
+ * Defines the interface for the frontier, the queue of URLs waiting to
+ * be fetched, shared by all of a crawler's fetching threads.
+ *
+ * The frontier keeps a separate queue for each server (as named by the
+ * url's serverName) and hands out URLs so as to be polite to all of
+ * them: no server ever has more than its maxConnections fetches under
+ * way at once, and each fetch from a server starts at least delay
+ * milliseconds after the previous one started and after the last one to
+ * finish finished.  Within that, each server's URLs come out highest
+ * priority first, and in the order they were added among equals.
+ *
+ * Servers that may be fetched from right now are kept in a heap ordered
+ * by the priority of their best URL, and servers that are waiting out
+ * their delay in a heap ordered by the time that delay runs out, so
+ * FrontierNext picks the next URL in time logarithmic in the number of
+ * servers, however many URLs are queued behind them.
+ *
+ * Every function may be called from any number of threads at once.
+ */
+
+/**
+ * Type: frontier
+ * --------------
+ * The concrete representation of the frontier.  The client should treat
+ * every field as private and go through the functions below.
+ */
+
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t changed;   // signalled whenever a URL may have become fetchable
+  void *hosts;              // the per-server queues and the two heaps
+  int maxConnections;
+  int delay;
+  int count;
+  bool closed;
+} frontier;
+
+/**
+ * Function: FrontierNew
+ * Usage: FrontierNew(&f, 2, 1000);
+ * ---------------------
+ * Initializes the specified frontier to be empty, allowing each server
+ * up to maxConnections fetches at a time, and delay milliseconds between
+ * fetches, unless FrontierSetHostPolicy says otherwise.
+ *
+ * An assert is raised unless maxConnections is positive and delay isn't
+ * negative.
+ */
+
+void FrontierNew(frontier *f, int maxConnections, int delay);
+
+/**
+ * Function: FrontierDispose
+ * -------------------------
+ * Releases all memory owned by the frontier, including the urls still
+ * queued in it.  No thread may be using the frontier any longer.
+ */
+
+void FrontierDispose(frontier *f);
+
+/**
+ * Function: FrontierSetHostPolicy
+ * Usage: FrontierSetHostPolicy(&f, "www.kottke.org", 1, 5000);
+ * -------------------------------
+ * Overrides maxConnections and delay for the one server (whose name is
+ * compared without regard to case), as a robots.txt Crawl-delay might
+ * ask.  The new policy governs fetches that haven't started yet.
+ */
+
+void FrontierSetHostPolicy(frontier *f, const char *serverName, int maxConnections, int delay);
+
+/**
+ * Function: FrontierAdd
+ * Usage: FrontierAdd(&f, &feedURL, 0);
+ * -------------------
+ * Queues the url for fetching with the given priority (higher numbers
+ * are fetched first).  The frontier takes ownership of the url's
+ * strings: the client mustn't dispose of the url afterwards, and
+ * receives it back from FrontierNext.
+ *
+ * An assert is raised if the frontier has been closed.
+ */
+
+void FrontierAdd(frontier *f, const url *u, int priority);
+
+/**
+ * Function: FrontierNext
+ * Usage: while (FrontierNext(&f, &u)) { ... FrontierDone(&f, &u); URLDispose(&u); }
+ * --------------------
+ * Waits until some queued url may be fetched, and then removes it from
+ * the frontier, copies it into the url addressed by u and returns true.
+ * The client then owns the url, and must call FrontierDone once the
+ * fetch is over, before disposing of it.  Returns false, leaving u alone,
+ * once the frontier has been closed and every url in it handed out.
+ */
+
+bool FrontierNext(frontier *f, url *u);
+
+/**
+ * Function: FrontierDone
+ * ----------------------
+ * Tells the frontier that the fetch of the url, which came from
+ * FrontierNext, is over (whether or not it succeeded), so that its
+ * server may be fetched from again once its delay has passed.
+ */
+
+void FrontierDone(frontier *f, const url *u);
+
+/**
+ * Function: FrontierClose
+ * -----------------------
+ * Declares that no more urls will be added.  Threads waiting in
+ * FrontierNext are woken up once there's nothing left for them to fetch,
+ * rather than waiting forever.
+ */
+
+void FrontierClose(frontier *f);
+
+/**
+ * Function: FrontierCount
+ * -----------------------
+ * Returns the number of urls queued in the frontier and not yet handed
+ * out by FrontierNext.
+ */
+
+int FrontierCount(frontier *f);
+
+#endif
@@ -2,6 +2,8 @@
 #include <assert.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <unistd.h>
 
 void HashSetNew(hashset *h, int elemSize, int numBuckets,
 		HashSetHashFunction hashfn, HashSetCompareFunction comparefn, HashSetFreeFunction freefn)
@@ -25,6 +27,7 @@ void HashSetNew(hashset *h, int elemSize, int numBuckets,
 	}
 	h->hashfn = hashfn;
 	h->comparefn = comparefn;
+	h->freefn = freefn;
 }
 
 void HashSetDispose(hashset *h)
@@ -93,3 +96,146 @@ void *HashSetLookup(hashset *h, const void *elemAddr)
 	else 
 		return VectorNth(theVector, elemLocation);
 }
+
+/**
+ * Moves one element out of a source bucket into the destination bucket.
+ * Only the first searchLength elements of the destination bucket are
+ * examined: elements merged in from the same source are already known to
+ * be distinct from one another.  Returns true if the element was added
+ * rather than folded into (or swapped for) an existing one.
+ */
+
+static bool MergeElement(const hashset *dst, vector *dstBucket, int searchLength, void *elemAddr,
+			 HashSetFreeFunction srcFreefn, HashSetCombineFunction combinefn)
+{
+	for (int i = 0; i < searchLength; i++) {
+		void *existing = VectorNth(dstBucket, i);
+		if (dst->comparefn(elemAddr, existing) != 0) continue;
+
+		if (combinefn != NULL) {
+			combinefn(existing, elemAddr);
+			if (srcFreefn != NULL) srcFreefn(elemAddr);
+		} else {
+			VectorReplace(dstBucket, elemAddr, i);
+		}
+		return false;
+	}
+
+	VectorAppend(dstBucket, elemAddr);
+	return true;
+}
+
+// merges bucket i of src into bucket i of dst, and returns the number of elements added
+static int MergeBucket(hashset *dst, hashset *src, int bucket, HashSetCombineFunction combinefn)
+{
+	vector *dstBucket = (vector *)((char *)dst->buckets + (bucket * sizeof(vector)));
+	vector *srcBucket = (vector *)((char *)src->buckets + (bucket * sizeof(vector)));
+	int searchLength = VectorLength(dstBucket);
+	int added = 0;
+
+	for (int i = 0; i < VectorLength(srcBucket); i++) {
+		if (MergeElement(dst, dstBucket, searchLength, VectorNth(srcBucket, i), src->freefn, combinefn))
+			added++;
+	}
+	VectorClear(srcBucket, false);
+	return added;
+}
+
+void HashSetMergeInto(hashset *dst, hashset *src, HashSetCombineFunction combinefn)
+{
+	assert(dst != NULL && src != NULL && dst != src);
+	assert(dst->elemSize == src->elemSize);
+
+	if (dst->numBuckets == src->numBuckets && dst->hashfn == src->hashfn) {
+		for (int i = 0; i < src->numBuckets; i++)
+			dst->elemCount += MergeBucket(dst, src, i, combinefn);
+	} else {
+		// the bucket geometry differs, so every element gets hashed (once) into dst
+		for (int i = 0; i < src->numBuckets; i++) {
+			vector *srcBucket = (vector *)((char *)src->buckets + (i * sizeof(vector)));
+			for (int j = 0; j < VectorLength(srcBucket); j++) {
+				void *elem = VectorNth(srcBucket, j);
+				int bucket = dst->hashfn(elem, dst->numBuckets);
+				assert(bucket >= 0 && bucket < dst->numBuckets);
+
+				vector *dstBucket = (vector *)((char *)dst->buckets + (bucket * sizeof(vector)));
+				if (MergeElement(dst, dstBucket, VectorLength(dstBucket), elem, src->freefn, combinefn))
+					dst->elemCount++;
+			}
+			VectorClear(srcBucket, false);
+		}
+	}
+	src->elemCount = 0;
+}
+
+typedef struct {
+	hashset *dst;
+	hashset **sources;
+	int numSources;
+	HashSetCombineFunction combinefn;
+	int firstBucket;
+	int lastBucket;
+	int added;
+	bool threaded;		// whether the job got a thread of its own to run on
+} mergejob;
+
+static void *MergeWorker(void *arg)
+{
+	mergejob *job = arg;
+
+	for (int i = job->firstBucket; i < job->lastBucket; i++) {
+		for (int k = 0; k < job->numSources; k++)
+			job->added += MergeBucket(job->dst, job->sources[k], i, job->combinefn);
+	}
+	return NULL;
+}
+
+void HashSetMergeAll(hashset *dst, hashset *sources[], int numSources,
+		     HashSetCombineFunction combinefn, int numThreads)
+{
+	assert(dst != NULL);
+	assert(sources != NULL && numSources >= 0);
+
+	for (int k = 0; k < numSources; k++) {
+		assert(sources[k] != NULL && sources[k] != dst);
+		assert(sources[k]->elemSize == dst->elemSize);
+		assert(sources[k]->numBuckets == dst->numBuckets);
+		assert(sources[k]->hashfn == dst->hashfn);
+	}
+
+	if (numThreads <= 0) numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (numThreads > dst->numBuckets) numThreads = dst->numBuckets;
+	if (numThreads < 1) numThreads = 1;
+
+	mergejob *jobs = malloc(numThreads * sizeof(mergejob));
+	pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+	assert(jobs != NULL && threads != NULL);
+
+	for (int t = 0; t < numThreads; t++) {
+		jobs[t].dst = dst;
+		jobs[t].sources = sources;
+		jobs[t].numSources = numSources;
+		jobs[t].combinefn = combinefn;
+		jobs[t].firstBucket = (int)((long)dst->numBuckets * t / numThreads);
+		jobs[t].lastBucket = (int)((long)dst->numBuckets * (t + 1) / numThreads);
+		jobs[t].added = 0;
+	}
+
+	// the calling thread takes the first range itself, and any range
+	// it can't start a thread for
+	for (int t = 1; t < numThreads; t++) {
+		jobs[t].threaded = (pthread_create(&threads[t], NULL, MergeWorker, &jobs[t]) == 0);
+		if (!jobs[t].threaded) MergeWorker(&jobs[t]);
+	}
+	MergeWorker(&jobs[0]);
+	for (int t = 1; t < numThreads; t++)
+		if (jobs[t].threaded) pthread_join(threads[t], NULL);
+
+	for (int t = 0; t < numThreads; t++)
+		dst->elemCount += jobs[t].added;
+	for (int k = 0; k < numSources; k++)
+		sources[k]->elemCount = 0;
+
+	free(jobs);
+	free(threads);
+}
@@ -62,6 +62,20 @@ typedef void (*HashSetMapFunction)(void *elemAddr, void *auxData);
 
 typedef void (*HashSetFreeFunction)(void *elemAddr);
 
+/**
+ * Type: HashSetCombineFunction
+ * ----------------------------
+ * Class of function called by HashSetMergeInto and HashSetMergeAll when an
+ * element of the source hashset matches one already in the destination.
+ * It should fold whatever it needs from the element at sourceElemAddr into
+ * the element at destElemAddr (adding word counts, say, or appending
+ * postings).  Afterwards the source element is handed to the source hashset's
+ * HashSetFreeFunction, so a combine function that steals resources from the
+ * source element must leave it in a state that function can safely dispose of.
+ */
+
+typedef void (*HashSetCombineFunction)(void *destElemAddr, void *sourceElemAddr);
+
 /**
  * Type: hashset
  * -------------
@@ -79,6 +93,7 @@ typedef struct {
   int elemCount;
   HashSetHashFunction hashfn;
   HashSetCompareFunction comparefn;
+  HashSetFreeFunction freefn;
 } hashset;
 
 /**
@@ -200,5 +215,44 @@ void *HashSetLookup(hashset *h, const void *elemAddr);
  */
 
 void HashSetMap(hashset *h, HashSetMapFunction mapfn, void *auxData);
+
+/**
+ * Function: HashSetMergeInto
+ * --------------------------
+ * Moves every element of src into dst, leaving src empty (but still
+ * initialized, so it must still be disposed of).  Elements whose match
+ * is already present in dst are folded into it by combinefn; if combinefn
+ * is NULL, the source element replaces the destination element instead,
+ * exactly as HashSetEnter would.
+ *
+ * Elements are moved by value, bucket by bucket, without being copied
+ * through HashSetEnter.  When src was created with the same numBuckets
+ * and hash function as dst (the usual case for per-thread indexes that
+ * are built identically), each source bucket maps straight onto the
+ * matching destination bucket and nothing is hashed at all; otherwise
+ * each element is hashed exactly once.
+ *
+ * An assert is raised if the two hashsets have different element sizes.
+ */
+
+void HashSetMergeInto(hashset *dst, hashset *src, HashSetCombineFunction combinefn);
+
+/**
+ * Function: HashSetMergeAll
+ * -------------------------
+ * Performs HashSetMergeInto(dst, sources[i], combinefn) for each of the
+ * numSources hashsets, in order, but splits the work across numThreads
+ * threads by bucket range: each thread merges the same contiguous run of
+ * buckets from every source, so no two threads ever touch the same bucket
+ * and no locking is needed.  Pass 0 for numThreads to use one thread per
+ * online processor.  The combine and free functions are called concurrently
+ * from several threads, each time on elements from different buckets.
+ *
+ * An assert is raised unless every source has the same element size,
+ * number of buckets and hash function as dst.
+ */
+
+void HashSetMergeAll(hashset *dst, hashset *sources[], int numSources,
+		     HashSetCombineFunction combinefn, int numThreads);
      
 #endif
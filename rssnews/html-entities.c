@@ -0,0 +1,2733 @@
+#include "html-entities.h"
+#include <ctype.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * The table below was generated from the WHATWG list of named character
+ * references (the same data as Python's html.entities.html5).  Names keep
+ * their ';'; the legacy names that may also appear without one are listed
+ * both ways.  Each entity also records the length of its name and of its
+ * UTF-8 expansion.
+ *
+ * kEntities is indexed through a "hash and displace" perfect hash, as the
+ * stop words in word-utils.c are.  A name hashes with seed 0 to one of 1024
+ * buckets, and the bucket's entry in kEntitySeeds is the seed under which
+ * the name lands in its own slot of kEntitySlots.  That slot holds the
+ * entity's index in kEntities, or -1 if no name landed there.  The seeds
+ * were found offline, largest bucket first.
+ *
+ * Every expansion is no longer than the "&name" it replaces except for
+ * "&nGt;" and "&nLt;", which each grow by one byte.
+ */
+
+typedef struct {
+  const char *name;
+  const char *value;
+  unsigned char nameLength;
+  unsigned char valueLength;
+} htmlentity;
+
+static const htmlentity kEntities[2231] = {
+  { "AElig", "Æ", 5, 2 },
+  { "AElig;", "Æ", 6, 2 },
+  { "AMP", "&", 3, 1 },
+  { "AMP;", "&", 4, 1 },
+  { "Aacute", "Á", 6, 2 },
+  { "Aacute;", "Á", 7, 2 },
+  { "Abreve;", "Ă", 7, 2 },
+  { "Acirc", "Â", 5, 2 },
+  { "Acirc;", "Â", 6, 2 },
+  { "Acy;", "А", 4, 2 },
+  { "Afr;", "𝔄", 4, 4 },
+  { "Agrave", "À", 6, 2 },
+  { "Agrave;", "À", 7, 2 },
+  { "Alpha;", "Α", 6, 2 },
+  { "Amacr;", "Ā", 6, 2 },
+  { "And;", "⩓", 4, 3 },
+  { "Aogon;", "Ą", 6, 2 },
+  { "Aopf;", "𝔸", 5, 4 },
+  { "ApplyFunction;", "\xE2\x81\xA1", 14, 3 },
+  { "Aring", "Å", 5, 2 },
+  { "Aring;", "Å", 6, 2 },
+  { "Ascr;", "𝒜", 5, 4 },
+  { "Assign;", "≔", 7, 3 },
+  { "Atilde", "Ã", 6, 2 },
+  { "Atilde;", "Ã", 7, 2 },
+  { "Auml", "Ä", 4, 2 },
+  { "Auml;", "Ä", 5, 2 },
+  { "Backslash;", "∖", 10, 3 },
+  { "Barv;", "⫧", 5, 3 },
+  { "Barwed;", "⌆", 7, 3 },
+  { "Bcy;", "Б", 4, 2 },
+  { "Because;", "∵", 8, 3 },
+  { "Bernoullis;", "ℬ", 11, 3 },
+  { "Beta;", "Β", 5, 2 },
+  { "Bfr;", "𝔅", 4, 4 },
+  { "Bopf;", "𝔹", 5, 4 },
+  { "Breve;", "˘", 6, 2 },
+  { "Bscr;", "ℬ", 5, 3 },
+  { "Bumpeq;", "≎", 7, 3 },
+  { "CHcy;", "Ч", 5, 2 },
+  { "COPY", "©", 4, 2 },
+  { "COPY;", "©", 5, 2 },
+  { "Cacute;", "Ć", 7, 2 },
+  { "Cap;", "⋒", 4, 3 },
+  { "CapitalDifferentialD;", "ⅅ", 21, 3 },
+  { "Cayleys;", "ℭ", 8, 3 },
+  { "Ccaron;", "Č", 7, 2 },
+  { "Ccedil", "Ç", 6, 2 },
+  { "Ccedil;", "Ç", 7, 2 },
+  { "Ccirc;", "Ĉ", 6, 2 },
+  { "Cconint;", "∰", 8, 3 },
+  { "Cdot;", "Ċ", 5, 2 },
+  { "Cedilla;", "¸", 8, 2 },
+  { "CenterDot;", "·", 10, 2 },
+  { "Cfr;", "ℭ", 4, 3 },
+  { "Chi;", "Χ", 4, 2 },
+  { "CircleDot;", "⊙", 10, 3 },
+  { "CircleMinus;", "⊖", 12, 3 },
+  { "CirclePlus;", "⊕", 11, 3 },
+  { "CircleTimes;", "⊗", 12, 3 },
+  { "ClockwiseContourIntegral;", "∲", 25, 3 },
+  { "CloseCurlyDoubleQuote;", "”", 22, 3 },
+  { "CloseCurlyQuote;", "’", 16, 3 },
+  { "Colon;", "∷", 6, 3 },
+  { "Colone;", "⩴", 7, 3 },
+  { "Congruent;", "≡", 10, 3 },
+  { "Conint;", "∯", 7, 3 },
+  { "ContourIntegral;", "∮", 16, 3 },
+  { "Copf;", "ℂ", 5, 3 },
+  { "Coproduct;", "∐", 10, 3 },
+  { "CounterClockwiseContourIntegral;", "∳", 32, 3 },
+  { "Cross;", "⨯", 6, 3 },
+  { "Cscr;", "𝒞", 5, 4 },
+  { "Cup;", "⋓", 4, 3 },
+  { "CupCap;", "≍", 7, 3 },
+  { "DD;", "ⅅ", 3, 3 },
+  { "DDotrahd;", "⤑", 9, 3 },
+  { "DJcy;", "Ђ", 5, 2 },
+  { "DScy;", "Ѕ", 5, 2 },
+  { "DZcy;", "Џ", 5, 2 },
+  { "Dagger;", "‡", 7, 3 },
+  { "Darr;", "↡", 5, 3 },
+  { "Dashv;", "⫤", 6, 3 },
+  { "Dcaron;", "Ď", 7, 2 },
+  { "Dcy;", "Д", 4, 2 },
+  { "Del;", "∇", 4, 3 },
+  { "Delta;", "Δ", 6, 2 },
+  { "Dfr;", "𝔇", 4, 4 },
+  { "DiacriticalAcute;", "´", 17, 2 },
+  { "DiacriticalDot;", "˙", 15, 2 },
+  { "DiacriticalDoubleAcute;", "˝", 23, 2 },
+  { "DiacriticalGrave;", "`", 17, 1 },
+  { "DiacriticalTilde;", "˜", 17, 2 },
+  { "Diamond;", "⋄", 8, 3 },
+  { "DifferentialD;", "ⅆ", 14, 3 },
+  { "Dopf;", "𝔻", 5, 4 },
+  { "Dot;", "¨", 4, 2 },
+  { "DotDot;", "\xE2\x83\x9C", 7, 3 },
+  { "DotEqual;", "≐", 9, 3 },
+  { "DoubleContourIntegral;", "∯", 22, 3 },
+  { "DoubleDot;", "¨", 10, 2 },
+  { "DoubleDownArrow;", "⇓", 16, 3 },
+  { "DoubleLeftArrow;", "⇐", 16, 3 },
+  { "DoubleLeftRightArrow;", "⇔", 21, 3 },
+  { "DoubleLeftTee;", "⫤", 14, 3 },
+  { "DoubleLongLeftArrow;", "⟸", 20, 3 },
+  { "DoubleLongLeftRightArrow;", "⟺", 25, 3 },
+  { "DoubleLongRightArrow;", "⟹", 21, 3 },
+  { "DoubleRightArrow;", "⇒", 17, 3 },
+  { "DoubleRightTee;", "⊨", 15, 3 },
+  { "DoubleUpArrow;", "⇑", 14, 3 },
+  { "DoubleUpDownArrow;", "⇕", 18, 3 },
+  { "DoubleVerticalBar;", "∥", 18, 3 },
+  { "DownArrow;", "↓", 10, 3 },
+  { "DownArrowBar;", "⤓", 13, 3 },
+  { "DownArrowUpArrow;", "⇵", 17, 3 },
+  { "DownBreve;", "\xCC\x91", 10, 2 },
+  { "DownLeftRightVector;", "⥐", 20, 3 },
+  { "DownLeftTeeVector;", "⥞", 18, 3 },
+  { "DownLeftVector;", "↽", 15, 3 },
+  { "DownLeftVectorBar;", "⥖", 18, 3 },
+  { "DownRightTeeVector;", "⥟", 19, 3 },
+  { "DownRightVector;", "⇁", 16, 3 },
+  { "DownRightVectorBar;", "⥗", 19, 3 },
+  { "DownTee;", "⊤", 8, 3 },
+  { "DownTeeArrow;", "↧", 13, 3 },
+  { "Downarrow;", "⇓", 10, 3 },
+  { "Dscr;", "𝒟", 5, 4 },
+  { "Dstrok;", "Đ", 7, 2 },
+  { "ENG;", "Ŋ", 4, 2 },
+  { "ETH", "Ð", 3, 2 },
+  { "ETH;", "Ð", 4, 2 },
+  { "Eacute", "É", 6, 2 },
+  { "Eacute;", "É", 7, 2 },
+  { "Ecaron;", "Ě", 7, 2 },
+  { "Ecirc", "Ê", 5, 2 },
+  { "Ecirc;", "Ê", 6, 2 },
+  { "Ecy;", "Э", 4, 2 },
+  { "Edot;", "Ė", 5, 2 },
+  { "Efr;", "𝔈", 4, 4 },
+  { "Egrave", "È", 6, 2 },
+  { "Egrave;", "È", 7, 2 },
+  { "Element;", "∈", 8, 3 },
+  { "Emacr;", "Ē", 6, 2 },
+  { "EmptySmallSquare;", "◻", 17, 3 },
+  { "EmptyVerySmallSquare;", "▫", 21, 3 },
+  { "Eogon;", "Ę", 6, 2 },
+  { "Eopf;", "𝔼", 5, 4 },
+  { "Epsilon;", "Ε", 8, 2 },
+  { "Equal;", "⩵", 6, 3 },
+  { "EqualTilde;", "≂", 11, 3 },
+  { "Equilibrium;", "⇌", 12, 3 },
+  { "Escr;", "ℰ", 5, 3 },
+  { "Esim;", "⩳", 5, 3 },
+  { "Eta;", "Η", 4, 2 },
+  { "Euml", "Ë", 4, 2 },
+  { "Euml;", "Ë", 5, 2 },
+  { "Exists;", "∃", 7, 3 },
+  { "ExponentialE;", "ⅇ", 13, 3 },
+  { "Fcy;", "Ф", 4, 2 },
+  { "Ffr;", "𝔉", 4, 4 },
+  { "FilledSmallSquare;", "◼", 18, 3 },
+  { "FilledVerySmallSquare;", "▪", 22, 3 },
+  { "Fopf;", "𝔽", 5, 4 },
+  { "ForAll;", "∀", 7, 3 },
+  { "Fouriertrf;", "ℱ", 11, 3 },
+  { "Fscr;", "ℱ", 5, 3 },
+  { "GJcy;", "Ѓ", 5, 2 },
+  { "GT", ">", 2, 1 },
+  { "GT;", ">", 3, 1 },
+  { "Gamma;", "Γ", 6, 2 },
+  { "Gammad;", "Ϝ", 7, 2 },
+  { "Gbreve;", "Ğ", 7, 2 },
+  { "Gcedil;", "Ģ", 7, 2 },
+  { "Gcirc;", "Ĝ", 6, 2 },
+  { "Gcy;", "Г", 4, 2 },
+  { "Gdot;", "Ġ", 5, 2 },
+  { "Gfr;", "𝔊", 4, 4 },
+  { "Gg;", "⋙", 3, 3 },
+  { "Gopf;", "𝔾", 5, 4 },
+  { "GreaterEqual;", "≥", 13, 3 },
+  { "GreaterEqualLess;", "⋛", 17, 3 },
+  { "GreaterFullEqual;", "≧", 17, 3 },
+  { "GreaterGreater;", "⪢", 15, 3 },
+  { "GreaterLess;", "≷", 12, 3 },
+  { "GreaterSlantEqual;", "⩾", 18, 3 },
+  { "GreaterTilde;", "≳", 13, 3 },
+  { "Gscr;", "𝒢", 5, 4 },
+  { "Gt;", "≫", 3, 3 },
+  { "HARDcy;", "Ъ", 7, 2 },
+  { "Hacek;", "ˇ", 6, 2 },
+  { "Hat;", "^", 4, 1 },
+  { "Hcirc;", "Ĥ", 6, 2 },
+  { "Hfr;", "ℌ", 4, 3 },
+  { "HilbertSpace;", "ℋ", 13, 3 },
+  { "Hopf;", "ℍ", 5, 3 },
+  { "HorizontalLine;", "─", 15, 3 },
+  { "Hscr;", "ℋ", 5, 3 },
+  { "Hstrok;", "Ħ", 7, 2 },
+  { "HumpDownHump;", "≎", 13, 3 },
+  { "HumpEqual;", "≏", 10, 3 },
+  { "IEcy;", "Е", 5, 2 },
+  { "IJlig;", "Ĳ", 6, 2 },
+  { "IOcy;", "Ё", 5, 2 },
+  { "Iacute", "Í", 6, 2 },
+  { "Iacute;", "Í", 7, 2 },
+  { "Icirc", "Î", 5, 2 },
+  { "Icirc;", "Î", 6, 2 },
+  { "Icy;", "И", 4, 2 },
+  { "Idot;", "İ", 5, 2 },
+  { "Ifr;", "ℑ", 4, 3 },
+  { "Igrave", "Ì", 6, 2 },
+  { "Igrave;", "Ì", 7, 2 },
+  { "Im;", "ℑ", 3, 3 },
+  { "Imacr;", "Ī", 6, 2 },
+  { "ImaginaryI;", "ⅈ", 11, 3 },
+  { "Implies;", "⇒", 8, 3 },
+  { "Int;", "∬", 4, 3 },
+  { "Integral;", "∫", 9, 3 },
+  { "Intersection;", "⋂", 13, 3 },
+  { "InvisibleComma;", "\xE2\x81\xA3", 15, 3 },
+  { "InvisibleTimes;", "\xE2\x81\xA2", 15, 3 },
+  { "Iogon;", "Į", 6, 2 },
+  { "Iopf;", "𝕀", 5, 4 },
+  { "Iota;", "Ι", 5, 2 },
+  { "Iscr;", "ℐ", 5, 3 },
+  { "Itilde;", "Ĩ", 7, 2 },
+  { "Iukcy;", "І", 6, 2 },
+  { "Iuml", "Ï", 4, 2 },
+  { "Iuml;", "Ï", 5, 2 },
+  { "Jcirc;", "Ĵ", 6, 2 },
+  { "Jcy;", "Й", 4, 2 },
+  { "Jfr;", "𝔍", 4, 4 },
+  { "Jopf;", "𝕁", 5, 4 },
+  { "Jscr;", "𝒥", 5, 4 },
+  { "Jsercy;", "Ј", 7, 2 },
+  { "Jukcy;", "Є", 6, 2 },
+  { "KHcy;", "Х", 5, 2 },
+  { "KJcy;", "Ќ", 5, 2 },
+  { "Kappa;", "Κ", 6, 2 },
+  { "Kcedil;", "Ķ", 7, 2 },
+  { "Kcy;", "К", 4, 2 },
+  { "Kfr;", "𝔎", 4, 4 },
+  { "Kopf;", "𝕂", 5, 4 },
+  { "Kscr;", "𝒦", 5, 4 },
+  { "LJcy;", "Љ", 5, 2 },
+  { "LT", "<", 2, 1 },
+  { "LT;", "<", 3, 1 },
+  { "Lacute;", "Ĺ", 7, 2 },
+  { "Lambda;", "Λ", 7, 2 },
+  { "Lang;", "⟪", 5, 3 },
+  { "Laplacetrf;", "ℒ", 11, 3 },
+  { "Larr;", "↞", 5, 3 },
+  { "Lcaron;", "Ľ", 7, 2 },
+  { "Lcedil;", "Ļ", 7, 2 },
+  { "Lcy;", "Л", 4, 2 },
+  { "LeftAngleBracket;", "⟨", 17, 3 },
+  { "LeftArrow;", "←", 10, 3 },
+  { "LeftArrowBar;", "⇤", 13, 3 },
+  { "LeftArrowRightArrow;", "⇆", 20, 3 },
+  { "LeftCeiling;", "⌈", 12, 3 },
+  { "LeftDoubleBracket;", "⟦", 18, 3 },
+  { "LeftDownTeeVector;", "⥡", 18, 3 },
+  { "LeftDownVector;", "⇃", 15, 3 },
+  { "LeftDownVectorBar;", "⥙", 18, 3 },
+  { "LeftFloor;", "⌊", 10, 3 },
+  { "LeftRightArrow;", "↔", 15, 3 },
+  { "LeftRightVector;", "⥎", 16, 3 },
+  { "LeftTee;", "⊣", 8, 3 },
+  { "LeftTeeArrow;", "↤", 13, 3 },
+  { "LeftTeeVector;", "⥚", 14, 3 },
+  { "LeftTriangle;", "⊲", 13, 3 },
+  { "LeftTriangleBar;", "⧏", 16, 3 },
+  { "LeftTriangleEqual;", "⊴", 18, 3 },
+  { "LeftUpDownVector;", "⥑", 17, 3 },
+  { "LeftUpTeeVector;", "⥠", 16, 3 },
+  { "LeftUpVector;", "↿", 13, 3 },
+  { "LeftUpVectorBar;", "⥘", 16, 3 },
+  { "LeftVector;", "↼", 11, 3 },
+  { "LeftVectorBar;", "⥒", 14, 3 },
+  { "Leftarrow;", "⇐", 10, 3 },
+  { "Leftrightarrow;", "⇔", 15, 3 },
+  { "LessEqualGreater;", "⋚", 17, 3 },
+  { "LessFullEqual;", "≦", 14, 3 },
+  { "LessGreater;", "≶", 12, 3 },
+  { "LessLess;", "⪡", 9, 3 },
+  { "LessSlantEqual;", "⩽", 15, 3 },
+  { "LessTilde;", "≲", 10, 3 },
+  { "Lfr;", "𝔏", 4, 4 },
+  { "Ll;", "⋘", 3, 3 },
+  { "Lleftarrow;", "⇚", 11, 3 },
+  { "Lmidot;", "Ŀ", 7, 2 },
+  { "LongLeftArrow;", "⟵", 14, 3 },
+  { "LongLeftRightArrow;", "⟷", 19, 3 },
+  { "LongRightArrow;", "⟶", 15, 3 },
+  { "Longleftarrow;", "⟸", 14, 3 },
+  { "Longleftrightarrow;", "⟺", 19, 3 },
+  { "Longrightarrow;", "⟹", 15, 3 },
+  { "Lopf;", "𝕃", 5, 4 },
+  { "LowerLeftArrow;", "↙", 15, 3 },
+  { "LowerRightArrow;", "↘", 16, 3 },
+  { "Lscr;", "ℒ", 5, 3 },
+  { "Lsh;", "↰", 4, 3 },
+  { "Lstrok;", "Ł", 7, 2 },
+  { "Lt;", "≪", 3, 3 },
+  { "Map;", "⤅", 4, 3 },
+  { "Mcy;", "М", 4, 2 },
+  { "MediumSpace;", "\xE2\x81\x9F", 12, 3 },
+  { "Mellintrf;", "ℳ", 10, 3 },
+  { "Mfr;", "𝔐", 4, 4 },
+  { "MinusPlus;", "∓", 10, 3 },
+  { "Mopf;", "𝕄", 5, 4 },
+  { "Mscr;", "ℳ", 5, 3 },
+  { "Mu;", "Μ", 3, 2 },
+  { "NJcy;", "Њ", 5, 2 },
+  { "Nacute;", "Ń", 7, 2 },
+  { "Ncaron;", "Ň", 7, 2 },
+  { "Ncedil;", "Ņ", 7, 2 },
+  { "Ncy;", "Н", 4, 2 },
+  { "NegativeMediumSpace;", "\xE2\x80\x8B", 20, 3 },
+  { "NegativeThickSpace;", "\xE2\x80\x8B", 19, 3 },
+  { "NegativeThinSpace;", "\xE2\x80\x8B", 18, 3 },
+  { "NegativeVeryThinSpace;", "\xE2\x80\x8B", 22, 3 },
+  { "NestedGreaterGreater;", "≫", 21, 3 },
+  { "NestedLessLess;", "≪", 15, 3 },
+  { "NewLine;", "\x0A", 8, 1 },
+  { "Nfr;", "𝔑", 4, 4 },
+  { "NoBreak;", "\xE2\x81\xA0", 8, 3 },
+  { "NonBreakingSpace;", "\xC2\xA0", 17, 2 },
+  { "Nopf;", "ℕ", 5, 3 },
+  { "Not;", "⫬", 4, 3 },
+  { "NotCongruent;", "≢", 13, 3 },
+  { "NotCupCap;", "≭", 10, 3 },
+  { "NotDoubleVerticalBar;", "∦", 21, 3 },
+  { "NotElement;", "∉", 11, 3 },
+  { "NotEqual;", "≠", 9, 3 },
+  { "NotEqualTilde;", "≂\xCC\xB8", 14, 5 },
+  { "NotExists;", "∄", 10, 3 },
+  { "NotGreater;", "≯", 11, 3 },
+  { "NotGreaterEqual;", "≱", 16, 3 },
+  { "NotGreaterFullEqual;", "≧\xCC\xB8", 20, 5 },
+  { "NotGreaterGreater;", "≫\xCC\xB8", 18, 5 },
+  { "NotGreaterLess;", "≹", 15, 3 },
+  { "NotGreaterSlantEqual;", "⩾\xCC\xB8", 21, 5 },
+  { "NotGreaterTilde;", "≵", 16, 3 },
+  { "NotHumpDownHump;", "≎\xCC\xB8", 16, 5 },
+  { "NotHumpEqual;", "≏\xCC\xB8", 13, 5 },
+  { "NotLeftTriangle;", "⋪", 16, 3 },
+  { "NotLeftTriangleBar;", "⧏\xCC\xB8", 19, 5 },
+  { "NotLeftTriangleEqual;", "⋬", 21, 3 },
+  { "NotLess;", "≮", 8, 3 },
+  { "NotLessEqual;", "≰", 13, 3 },
+  { "NotLessGreater;", "≸", 15, 3 },
+  { "NotLessLess;", "≪\xCC\xB8", 12, 5 },
+  { "NotLessSlantEqual;", "⩽\xCC\xB8", 18, 5 },
+  { "NotLessTilde;", "≴", 13, 3 },
+  { "NotNestedGreaterGreater;", "⪢\xCC\xB8", 24, 5 },
+  { "NotNestedLessLess;", "⪡\xCC\xB8", 18, 5 },
+  { "NotPrecedes;", "⊀", 12, 3 },
+  { "NotPrecedesEqual;", "⪯\xCC\xB8", 17, 5 },
+  { "NotPrecedesSlantEqual;", "⋠", 22, 3 },
+  { "NotReverseElement;", "∌", 18, 3 },
+  { "NotRightTriangle;", "⋫", 17, 3 },
+  { "NotRightTriangleBar;", "⧐\xCC\xB8", 20, 5 },
+  { "NotRightTriangleEqual;", "⋭", 22, 3 },
+  { "NotSquareSubset;", "⊏\xCC\xB8", 16, 5 },
+  { "NotSquareSubsetEqual;", "⋢", 21, 3 },
+  { "NotSquareSuperset;", "⊐\xCC\xB8", 18, 5 },
+  { "NotSquareSupersetEqual;", "⋣", 23, 3 },
+  { "NotSubset;", "⊂\xE2\x83\x92", 10, 6 },
+  { "NotSubsetEqual;", "⊈", 15, 3 },
+  { "NotSucceeds;", "⊁", 12, 3 },
+  { "NotSucceedsEqual;", "⪰\xCC\xB8", 17, 5 },
+  { "NotSucceedsSlantEqual;", "⋡", 22, 3 },
+  { "NotSucceedsTilde;", "≿\xCC\xB8", 17, 5 },
+  { "NotSuperset;", "⊃\xE2\x83\x92", 12, 6 },
+  { "NotSupersetEqual;", "⊉", 17, 3 },
+  { "NotTilde;", "≁", 9, 3 },
+  { "NotTildeEqual;", "≄", 14, 3 },
+  { "NotTildeFullEqual;", "≇", 18, 3 },
+  { "NotTildeTilde;", "≉", 14, 3 },
+  { "NotVerticalBar;", "∤", 15, 3 },
+  { "Nscr;", "𝒩", 5, 4 },
+  { "Ntilde", "Ñ", 6, 2 },
+  { "Ntilde;", "Ñ", 7, 2 },
+  { "Nu;", "Ν", 3, 2 },
+  { "OElig;", "Œ", 6, 2 },
+  { "Oacute", "Ó", 6, 2 },
+  { "Oacute;", "Ó", 7, 2 },
+  { "Ocirc", "Ô", 5, 2 },
+  { "Ocirc;", "Ô", 6, 2 },
+  { "Ocy;", "О", 4, 2 },
+  { "Odblac;", "Ő", 7, 2 },
+  { "Ofr;", "𝔒", 4, 4 },
+  { "Ograve", "Ò", 6, 2 },
+  { "Ograve;", "Ò", 7, 2 },
+  { "Omacr;", "Ō", 6, 2 },
+  { "Omega;", "Ω", 6, 2 },
+  { "Omicron;", "Ο", 8, 2 },
+  { "Oopf;", "𝕆", 5, 4 },
+  { "OpenCurlyDoubleQuote;", "“", 21, 3 },
+  { "OpenCurlyQuote;", "‘", 15, 3 },
+  { "Or;", "⩔", 3, 3 },
+  { "Oscr;", "𝒪", 5, 4 },
+  { "Oslash", "Ø", 6, 2 },
+  { "Oslash;", "Ø", 7, 2 },
+  { "Otilde", "Õ", 6, 2 },
+  { "Otilde;", "Õ", 7, 2 },
+  { "Otimes;", "⨷", 7, 3 },
+  { "Ouml", "Ö", 4, 2 },
+  { "Ouml;", "Ö", 5, 2 },
+  { "OverBar;", "‾", 8, 3 },
+  { "OverBrace;", "⏞", 10, 3 },
+  { "OverBracket;", "⎴", 12, 3 },
+  { "OverParenthesis;", "⏜", 16, 3 },
+  { "PartialD;", "∂", 9, 3 },
+  { "Pcy;", "П", 4, 2 },
+  { "Pfr;", "𝔓", 4, 4 },
+  { "Phi;", "Φ", 4, 2 },
+  { "Pi;", "Π", 3, 2 },
+  { "PlusMinus;", "±", 10, 2 },
+  { "Poincareplane;", "ℌ", 14, 3 },
+  { "Popf;", "ℙ", 5, 3 },
+  { "Pr;", "⪻", 3, 3 },
+  { "Precedes;", "≺", 9, 3 },
+  { "PrecedesEqual;", "⪯", 14, 3 },
+  { "PrecedesSlantEqual;", "≼", 19, 3 },
+  { "PrecedesTilde;", "≾", 14, 3 },
+  { "Prime;", "″", 6, 3 },
+  { "Product;", "∏", 8, 3 },
+  { "Proportion;", "∷", 11, 3 },
+  { "Proportional;", "∝", 13, 3 },
+  { "Pscr;", "𝒫", 5, 4 },
+  { "Psi;", "Ψ", 4, 2 },
+  { "QUOT", "\"", 4, 1 },
+  { "QUOT;", "\"", 5, 1 },
+  { "Qfr;", "𝔔", 4, 4 },
+  { "Qopf;", "ℚ", 5, 3 },
+  { "Qscr;", "𝒬", 5, 4 },
+  { "RBarr;", "⤐", 6, 3 },
+  { "REG", "®", 3, 2 },
+  { "REG;", "®", 4, 2 },
+  { "Racute;", "Ŕ", 7, 2 },
+  { "Rang;", "⟫", 5, 3 },
+  { "Rarr;", "↠", 5, 3 },
+  { "Rarrtl;", "⤖", 7, 3 },
+  { "Rcaron;", "Ř", 7, 2 },
+  { "Rcedil;", "Ŗ", 7, 2 },
+  { "Rcy;", "Р", 4, 2 },
+  { "Re;", "ℜ", 3, 3 },
+  { "ReverseElement;", "∋", 15, 3 },
+  { "ReverseEquilibrium;", "⇋", 19, 3 },
+  { "ReverseUpEquilibrium;", "⥯", 21, 3 },
+  { "Rfr;", "ℜ", 4, 3 },
+  { "Rho;", "Ρ", 4, 2 },
+  { "RightAngleBracket;", "⟩", 18, 3 },
+  { "RightArrow;", "→", 11, 3 },
+  { "RightArrowBar;", "⇥", 14, 3 },
+  { "RightArrowLeftArrow;", "⇄", 20, 3 },
+  { "RightCeiling;", "⌉", 13, 3 },
+  { "RightDoubleBracket;", "⟧", 19, 3 },
+  { "RightDownTeeVector;", "⥝", 19, 3 },
+  { "RightDownVector;", "⇂", 16, 3 },
+  { "RightDownVectorBar;", "⥕", 19, 3 },
+  { "RightFloor;", "⌋", 11, 3 },
+  { "RightTee;", "⊢", 9, 3 },
+  { "RightTeeArrow;", "↦", 14, 3 },
+  { "RightTeeVector;", "⥛", 15, 3 },
+  { "RightTriangle;", "⊳", 14, 3 },
+  { "RightTriangleBar;", "⧐", 17, 3 },
+  { "RightTriangleEqual;", "⊵", 19, 3 },
+  { "RightUpDownVector;", "⥏", 18, 3 },
+  { "RightUpTeeVector;", "⥜", 17, 3 },
+  { "RightUpVector;", "↾", 14, 3 },
+  { "RightUpVectorBar;", "⥔", 17, 3 },
+  { "RightVector;", "⇀", 12, 3 },
+  { "RightVectorBar;", "⥓", 15, 3 },
+  { "Rightarrow;", "⇒", 11, 3 },
+  { "Ropf;", "ℝ", 5, 3 },
+  { "RoundImplies;", "⥰", 13, 3 },
+  { "Rrightarrow;", "⇛", 12, 3 },
+  { "Rscr;", "ℛ", 5, 3 },
+  { "Rsh;", "↱", 4, 3 },
+  { "RuleDelayed;", "⧴", 12, 3 },
+  { "SHCHcy;", "Щ", 7, 2 },
+  { "SHcy;", "Ш", 5, 2 },
+  { "SOFTcy;", "Ь", 7, 2 },
+  { "Sacute;", "Ś", 7, 2 },
+  { "Sc;", "⪼", 3, 3 },
+  { "Scaron;", "Š", 7, 2 },
+  { "Scedil;", "Ş", 7, 2 },
+  { "Scirc;", "Ŝ", 6, 2 },
+  { "Scy;", "С", 4, 2 },
+  { "Sfr;", "𝔖", 4, 4 },
+  { "ShortDownArrow;", "↓", 15, 3 },
+  { "ShortLeftArrow;", "←", 15, 3 },
+  { "ShortRightArrow;", "→", 16, 3 },
+  { "ShortUpArrow;", "↑", 13, 3 },
+  { "Sigma;", "Σ", 6, 2 },
+  { "SmallCircle;", "∘", 12, 3 },
+  { "Sopf;", "𝕊", 5, 4 },
+  { "Sqrt;", "√", 5, 3 },
+  { "Square;", "□", 7, 3 },
+  { "SquareIntersection;", "⊓", 19, 3 },
+  { "SquareSubset;", "⊏", 13, 3 },
+  { "SquareSubsetEqual;", "⊑", 18, 3 },
+  { "SquareSuperset;", "⊐", 15, 3 },
+  { "SquareSupersetEqual;", "⊒", 20, 3 },
+  { "SquareUnion;", "⊔", 12, 3 },
+  { "Sscr;", "𝒮", 5, 4 },
+  { "Star;", "⋆", 5, 3 },
+  { "Sub;", "⋐", 4, 3 },
+  { "Subset;", "⋐", 7, 3 },
+  { "SubsetEqual;", "⊆", 12, 3 },
+  { "Succeeds;", "≻", 9, 3 },
+  { "SucceedsEqual;", "⪰", 14, 3 },
+  { "SucceedsSlantEqual;", "≽", 19, 3 },
+  { "SucceedsTilde;", "≿", 14, 3 },
+  { "SuchThat;", "∋", 9, 3 },
+  { "Sum;", "∑", 4, 3 },
+  { "Sup;", "⋑", 4, 3 },
+  { "Superset;", "⊃", 9, 3 },
+  { "SupersetEqual;", "⊇", 14, 3 },
+  { "Supset;", "⋑", 7, 3 },
+  { "THORN", "Þ", 5, 2 },
+  { "THORN;", "Þ", 6, 2 },
+  { "TRADE;", "™", 6, 3 },
+  { "TSHcy;", "Ћ", 6, 2 },
+  { "TScy;", "Ц", 5, 2 },
+  { "Tab;", "\x09", 4, 1 },
+  { "Tau;", "Τ", 4, 2 },
+  { "Tcaron;", "Ť", 7, 2 },
+  { "Tcedil;", "Ţ", 7, 2 },
+  { "Tcy;", "Т", 4, 2 },
+  { "Tfr;", "𝔗", 4, 4 },
+  { "Therefore;", "∴", 10, 3 },
+  { "Theta;", "Θ", 6, 2 },
+  { "ThickSpace;", "\xE2\x81\x9F\xE2\x80\x8A", 11, 6 },
+  { "ThinSpace;", "\xE2\x80\x89", 10, 3 },
+  { "Tilde;", "∼", 6, 3 },
+  { "TildeEqual;", "≃", 11, 3 },
+  { "TildeFullEqual;", "≅", 15, 3 },
+  { "TildeTilde;", "≈", 11, 3 },
+  { "Topf;", "𝕋", 5, 4 },
+  { "TripleDot;", "\xE2\x83\x9B", 10, 3 },
+  { "Tscr;", "𝒯", 5, 4 },
+  { "Tstrok;", "Ŧ", 7, 2 },
+  { "Uacute", "Ú", 6, 2 },
+  { "Uacute;", "Ú", 7, 2 },
+  { "Uarr;", "↟", 5, 3 },
+  { "Uarrocir;", "⥉", 9, 3 },
+  { "Ubrcy;", "Ў", 6, 2 },
+  { "Ubreve;", "Ŭ", 7, 2 },
+  { "Ucirc", "Û", 5, 2 },
+  { "Ucirc;", "Û", 6, 2 },
+  { "Ucy;", "У", 4, 2 },
+  { "Udblac;", "Ű", 7, 2 },
+  { "Ufr;", "𝔘", 4, 4 },
+  { "Ugrave", "Ù", 6, 2 },
+  { "Ugrave;", "Ù", 7, 2 },
+  { "Umacr;", "Ū", 6, 2 },
+  { "UnderBar;", "_", 9, 1 },
+  { "UnderBrace;", "⏟", 11, 3 },
+  { "UnderBracket;", "⎵", 13, 3 },
+  { "UnderParenthesis;", "⏝", 17, 3 },
+  { "Union;", "⋃", 6, 3 },
+  { "UnionPlus;", "⊎", 10, 3 },
+  { "Uogon;", "Ų", 6, 2 },
+  { "Uopf;", "𝕌", 5, 4 },
+  { "UpArrow;", "↑", 8, 3 },
+  { "UpArrowBar;", "⤒", 11, 3 },
+  { "UpArrowDownArrow;", "⇅", 17, 3 },
+  { "UpDownArrow;", "↕", 12, 3 },
+  { "UpEquilibrium;", "⥮", 14, 3 },
+  { "UpTee;", "⊥", 6, 3 },
+  { "UpTeeArrow;", "↥", 11, 3 },
+  { "Uparrow;", "⇑", 8, 3 },
+  { "Updownarrow;", "⇕", 12, 3 },
+  { "UpperLeftArrow;", "↖", 15, 3 },
+  { "UpperRightArrow;", "↗", 16, 3 },
+  { "Upsi;", "ϒ", 5, 2 },
+  { "Upsilon;", "Υ", 8, 2 },
+  { "Uring;", "Ů", 6, 2 },
+  { "Uscr;", "𝒰", 5, 4 },
+  { "Utilde;", "Ũ", 7, 2 },
+  { "Uuml", "Ü", 4, 2 },
+  { "Uuml;", "Ü", 5, 2 },
+  { "VDash;", "⊫", 6, 3 },
+  { "Vbar;", "⫫", 5, 3 },
+  { "Vcy;", "В", 4, 2 },
+  { "Vdash;", "⊩", 6, 3 },
+  { "Vdashl;", "⫦", 7, 3 },
+  { "Vee;", "⋁", 4, 3 },
+  { "Verbar;", "‖", 7, 3 },
+  { "Vert;", "‖", 5, 3 },
+  { "VerticalBar;", "∣", 12, 3 },
+  { "VerticalLine;", "|", 13, 1 },
+  { "VerticalSeparator;", "❘", 18, 3 },
+  { "VerticalTilde;", "≀", 14, 3 },
+  { "VeryThinSpace;", "\xE2\x80\x8A", 14, 3 },
+  { "Vfr;", "𝔙", 4, 4 },
+  { "Vopf;", "𝕍", 5, 4 },
+  { "Vscr;", "𝒱", 5, 4 },
+  { "Vvdash;", "⊪", 7, 3 },
+  { "Wcirc;", "Ŵ", 6, 2 },
+  { "Wedge;", "⋀", 6, 3 },
+  { "Wfr;", "𝔚", 4, 4 },
+  { "Wopf;", "𝕎", 5, 4 },
+  { "Wscr;", "𝒲", 5, 4 },
+  { "Xfr;", "𝔛", 4, 4 },
+  { "Xi;", "Ξ", 3, 2 },
+  { "Xopf;", "𝕏", 5, 4 },
+  { "Xscr;", "𝒳", 5, 4 },
+  { "YAcy;", "Я", 5, 2 },
+  { "YIcy;", "Ї", 5, 2 },
+  { "YUcy;", "Ю", 5, 2 },
+  { "Yacute", "Ý", 6, 2 },
+  { "Yacute;", "Ý", 7, 2 },
+  { "Ycirc;", "Ŷ", 6, 2 },
+  { "Ycy;", "Ы", 4, 2 },
+  { "Yfr;", "𝔜", 4, 4 },
+  { "Yopf;", "𝕐", 5, 4 },
+  { "Yscr;", "𝒴", 5, 4 },
+  { "Yuml;", "Ÿ", 5, 2 },
+  { "ZHcy;", "Ж", 5, 2 },
+  { "Zacute;", "Ź", 7, 2 },
+  { "Zcaron;", "Ž", 7, 2 },
+  { "Zcy;", "З", 4, 2 },
+  { "Zdot;", "Ż", 5, 2 },
+  { "ZeroWidthSpace;", "\xE2\x80\x8B", 15, 3 },
+  { "Zeta;", "Ζ", 5, 2 },
+  { "Zfr;", "ℨ", 4, 3 },
+  { "Zopf;", "ℤ", 5, 3 },
+  { "Zscr;", "𝒵", 5, 4 },
+  { "aacute", "á", 6, 2 },
+  { "aacute;", "á", 7, 2 },
+  { "abreve;", "ă", 7, 2 },
+  { "ac;", "∾", 3, 3 },
+  { "acE;", "∾\xCC\xB3", 4, 5 },
+  { "acd;", "∿", 4, 3 },
+  { "acirc", "â", 5, 2 },
+  { "acirc;", "â", 6, 2 },
+  { "acute", "´", 5, 2 },
+  { "acute;", "´", 6, 2 },
+  { "acy;", "а", 4, 2 },
+  { "aelig", "æ", 5, 2 },
+  { "aelig;", "æ", 6, 2 },
+  { "af;", "\xE2\x81\xA1", 3, 3 },
+  { "afr;", "𝔞", 4, 4 },
+  { "agrave", "à", 6, 2 },
+  { "agrave;", "à", 7, 2 },
+  { "alefsym;", "ℵ", 8, 3 },
+  { "aleph;", "ℵ", 6, 3 },
+  { "alpha;", "α", 6, 2 },
+  { "amacr;", "ā", 6, 2 },
+  { "amalg;", "⨿", 6, 3 },
+  { "amp", "&", 3, 1 },
+  { "amp;", "&", 4, 1 },
+  { "and;", "∧", 4, 3 },
+  { "andand;", "⩕", 7, 3 },
+  { "andd;", "⩜", 5, 3 },
+  { "andslope;", "⩘", 9, 3 },
+  { "andv;", "⩚", 5, 3 },
+  { "ang;", "∠", 4, 3 },
+  { "ange;", "⦤", 5, 3 },
+  { "angle;", "∠", 6, 3 },
+  { "angmsd;", "∡", 7, 3 },
+  { "angmsdaa;", "⦨", 9, 3 },
+  { "angmsdab;", "⦩", 9, 3 },
+  { "angmsdac;", "⦪", 9, 3 },
+  { "angmsdad;", "⦫", 9, 3 },
+  { "angmsdae;", "⦬", 9, 3 },
+  { "angmsdaf;", "⦭", 9, 3 },
+  { "angmsdag;", "⦮", 9, 3 },
+  { "angmsdah;", "⦯", 9, 3 },
+  { "angrt;", "∟", 6, 3 },
+  { "angrtvb;", "⊾", 8, 3 },
+  { "angrtvbd;", "⦝", 9, 3 },
+  { "angsph;", "∢", 7, 3 },
+  { "angst;", "Å", 6, 2 },
+  { "angzarr;", "⍼", 8, 3 },
+  { "aogon;", "ą", 6, 2 },
+  { "aopf;", "𝕒", 5, 4 },
+  { "ap;", "≈", 3, 3 },
+  { "apE;", "⩰", 4, 3 },
+  { "apacir;", "⩯", 7, 3 },
+  { "ape;", "≊", 4, 3 },
+  { "apid;", "≋", 5, 3 },
+  { "apos;", "'", 5, 1 },
+  { "approx;", "≈", 7, 3 },
+  { "approxeq;", "≊", 9, 3 },
+  { "aring", "å", 5, 2 },
+  { "aring;", "å", 6, 2 },
+  { "ascr;", "𝒶", 5, 4 },
+  { "ast;", "*", 4, 1 },
+  { "asymp;", "≈", 6, 3 },
+  { "asympeq;", "≍", 8, 3 },
+  { "atilde", "ã", 6, 2 },
+  { "atilde;", "ã", 7, 2 },
+  { "auml", "ä", 4, 2 },
+  { "auml;", "ä", 5, 2 },
+  { "awconint;", "∳", 9, 3 },
+  { "awint;", "⨑", 6, 3 },
+  { "bNot;", "⫭", 5, 3 },
+  { "backcong;", "≌", 9, 3 },
+  { "backepsilon;", "϶", 12, 2 },
+  { "backprime;", "‵", 10, 3 },
+  { "backsim;", "∽", 8, 3 },
+  { "backsimeq;", "⋍", 10, 3 },
+  { "barvee;", "⊽", 7, 3 },
+  { "barwed;", "⌅", 7, 3 },
+  { "barwedge;", "⌅", 9, 3 },
+  { "bbrk;", "⎵", 5, 3 },
+  { "bbrktbrk;", "⎶", 9, 3 },
+  { "bcong;", "≌", 6, 3 },
+  { "bcy;", "б", 4, 2 },
+  { "bdquo;", "„", 6, 3 },
+  { "becaus;", "∵", 7, 3 },
+  { "because;", "∵", 8, 3 },
+  { "bemptyv;", "⦰", 8, 3 },
+  { "bepsi;", "϶", 6, 2 },
+  { "bernou;", "ℬ", 7, 3 },
+  { "beta;", "β", 5, 2 },
+  { "beth;", "ℶ", 5, 3 },
+  { "between;", "≬", 8, 3 },
+  { "bfr;", "𝔟", 4, 4 },
+  { "bigcap;", "⋂", 7, 3 },
+  { "bigcirc;", "◯", 8, 3 },
+  { "bigcup;", "⋃", 7, 3 },
+  { "bigodot;", "⨀", 8, 3 },
+  { "bigoplus;", "⨁", 9, 3 },
+  { "bigotimes;", "⨂", 10, 3 },
+  { "bigsqcup;", "⨆", 9, 3 },
+  { "bigstar;", "★", 8, 3 },
+  { "bigtriangledown;", "▽", 16, 3 },
+  { "bigtriangleup;", "△", 14, 3 },
+  { "biguplus;", "⨄", 9, 3 },
+  { "bigvee;", "⋁", 7, 3 },
+  { "bigwedge;", "⋀", 9, 3 },
+  { "bkarow;", "⤍", 7, 3 },
+  { "blacklozenge;", "⧫", 13, 3 },
+  { "blacksquare;", "▪", 12, 3 },
+  { "blacktriangle;", "▴", 14, 3 },
+  { "blacktriangledown;", "▾", 18, 3 },
+  { "blacktriangleleft;", "◂", 18, 3 },
+  { "blacktriangleright;", "▸", 19, 3 },
+  { "blank;", "␣", 6, 3 },
+  { "blk12;", "▒", 6, 3 },
+  { "blk14;", "░", 6, 3 },
+  { "blk34;", "▓", 6, 3 },
+  { "block;", "█", 6, 3 },
+  { "bne;", "=\xE2\x83\xA5", 4, 4 },
+  { "bnequiv;", "≡\xE2\x83\xA5", 8, 6 },
+  { "bnot;", "⌐", 5, 3 },
+  { "bopf;", "𝕓", 5, 4 },
+  { "bot;", "⊥", 4, 3 },
+  { "bottom;", "⊥", 7, 3 },
+  { "bowtie;", "⋈", 7, 3 },
+  { "boxDL;", "╗", 6, 3 },
+  { "boxDR;", "╔", 6, 3 },
+  { "boxDl;", "╖", 6, 3 },
+  { "boxDr;", "╓", 6, 3 },
+  { "boxH;", "═", 5, 3 },
+  { "boxHD;", "╦", 6, 3 },
+  { "boxHU;", "╩", 6, 3 },
+  { "boxHd;", "╤", 6, 3 },
+  { "boxHu;", "╧", 6, 3 },
+  { "boxUL;", "╝", 6, 3 },
+  { "boxUR;", "╚", 6, 3 },
+  { "boxUl;", "╜", 6, 3 },
+  { "boxUr;", "╙", 6, 3 },
+  { "boxV;", "║", 5, 3 },
+  { "boxVH;", "╬", 6, 3 },
+  { "boxVL;", "╣", 6, 3 },
+  { "boxVR;", "╠", 6, 3 },
+  { "boxVh;", "╫", 6, 3 },
+  { "boxVl;", "╢", 6, 3 },
+  { "boxVr;", "╟", 6, 3 },
+  { "boxbox;", "⧉", 7, 3 },
+  { "boxdL;", "╕", 6, 3 },
+  { "boxdR;", "╒", 6, 3 },
+  { "boxdl;", "┐", 6, 3 },
+  { "boxdr;", "┌", 6, 3 },
+  { "boxh;", "─", 5, 3 },
+  { "boxhD;", "╥", 6, 3 },
+  { "boxhU;", "╨", 6, 3 },
+  { "boxhd;", "┬", 6, 3 },
+  { "boxhu;", "┴", 6, 3 },
+  { "boxminus;", "⊟", 9, 3 },
+  { "boxplus;", "⊞", 8, 3 },
+  { "boxtimes;", "⊠", 9, 3 },
+  { "boxuL;", "╛", 6, 3 },
+  { "boxuR;", "╘", 6, 3 },
+  { "boxul;", "┘", 6, 3 },
+  { "boxur;", "└", 6, 3 },
+  { "boxv;", "│", 5, 3 },
+  { "boxvH;", "╪", 6, 3 },
+  { "boxvL;", "╡", 6, 3 },
+  { "boxvR;", "╞", 6, 3 },
+  { "boxvh;", "┼", 6, 3 },
+  { "boxvl;", "┤", 6, 3 },
+  { "boxvr;", "├", 6, 3 },
+  { "bprime;", "‵", 7, 3 },
+  { "breve;", "˘", 6, 2 },
+  { "brvbar", "¦", 6, 2 },
+  { "brvbar;", "¦", 7, 2 },
+  { "bscr;", "𝒷", 5, 4 },
+  { "bsemi;", "⁏", 6, 3 },
+  { "bsim;", "∽", 5, 3 },
+  { "bsime;", "⋍", 6, 3 },
+  { "bsol;", "\\", 5, 1 },
+  { "bsolb;", "⧅", 6, 3 },
+  { "bsolhsub;", "⟈", 9, 3 },
+  { "bull;", "•", 5, 3 },
+  { "bullet;", "•", 7, 3 },
+  { "bump;", "≎", 5, 3 },
+  { "bumpE;", "⪮", 6, 3 },
+  { "bumpe;", "≏", 6, 3 },
+  { "bumpeq;", "≏", 7, 3 },
+  { "cacute;", "ć", 7, 2 },
+  { "cap;", "∩", 4, 3 },
+  { "capand;", "⩄", 7, 3 },
+  { "capbrcup;", "⩉", 9, 3 },
+  { "capcap;", "⩋", 7, 3 },
+  { "capcup;", "⩇", 7, 3 },
+  { "capdot;", "⩀", 7, 3 },
+  { "caps;", "∩\xEF\xB8\x80", 5, 6 },
+  { "caret;", "⁁", 6, 3 },
+  { "caron;", "ˇ", 6, 2 },
+  { "ccaps;", "⩍", 6, 3 },
+  { "ccaron;", "č", 7, 2 },
+  { "ccedil", "ç", 6, 2 },
+  { "ccedil;", "ç", 7, 2 },
+  { "ccirc;", "ĉ", 6, 2 },
+  { "ccups;", "⩌", 6, 3 },
+  { "ccupssm;", "⩐", 8, 3 },
+  { "cdot;", "ċ", 5, 2 },
+  { "cedil", "¸", 5, 2 },
+  { "cedil;", "¸", 6, 2 },
+  { "cemptyv;", "⦲", 8, 3 },
+  { "cent", "¢", 4, 2 },
+  { "cent;", "¢", 5, 2 },
+  { "centerdot;", "·", 10, 2 },
+  { "cfr;", "𝔠", 4, 4 },
+  { "chcy;", "ч", 5, 2 },
+  { "check;", "✓", 6, 3 },
+  { "checkmark;", "✓", 10, 3 },
+  { "chi;", "χ", 4, 2 },
+  { "cir;", "○", 4, 3 },
+  { "cirE;", "⧃", 5, 3 },
+  { "circ;", "ˆ", 5, 2 },
+  { "circeq;", "≗", 7, 3 },
+  { "circlearrowleft;", "↺", 16, 3 },
+  { "circlearrowright;", "↻", 17, 3 },
+  { "circledR;", "®", 9, 2 },
+  { "circledS;", "Ⓢ", 9, 3 },
+  { "circledast;", "⊛", 11, 3 },
+  { "circledcirc;", "⊚", 12, 3 },
+  { "circleddash;", "⊝", 12, 3 },
+  { "cire;", "≗", 5, 3 },
+  { "cirfnint;", "⨐", 9, 3 },
+  { "cirmid;", "⫯", 7, 3 },
+  { "cirscir;", "⧂", 8, 3 },
+  { "clubs;", "♣", 6, 3 },
+  { "clubsuit;", "♣", 9, 3 },
+  { "colon;", ":", 6, 1 },
+  { "colone;", "≔", 7, 3 },
+  { "coloneq;", "≔", 8, 3 },
+  { "comma;", ",", 6, 1 },
+  { "commat;", "@", 7, 1 },
+  { "comp;", "∁", 5, 3 },
+  { "compfn;", "∘", 7, 3 },
+  { "complement;", "∁", 11, 3 },
+  { "complexes;", "ℂ", 10, 3 },
+  { "cong;", "≅", 5, 3 },
+  { "congdot;", "⩭", 8, 3 },
+  { "conint;", "∮", 7, 3 },
+  { "copf;", "𝕔", 5, 4 },
+  { "coprod;", "∐", 7, 3 },
+  { "copy", "©", 4, 2 },
+  { "copy;", "©", 5, 2 },
+  { "copysr;", "℗", 7, 3 },
+  { "crarr;", "↵", 6, 3 },
+  { "cross;", "✗", 6, 3 },
+  { "cscr;", "𝒸", 5, 4 },
+  { "csub;", "⫏", 5, 3 },
+  { "csube;", "⫑", 6, 3 },
+  { "csup;", "⫐", 5, 3 },
+  { "csupe;", "⫒", 6, 3 },
+  { "ctdot;", "⋯", 6, 3 },
+  { "cudarrl;", "⤸", 8, 3 },
+  { "cudarrr;", "⤵", 8, 3 },
+  { "cuepr;", "⋞", 6, 3 },
+  { "cuesc;", "⋟", 6, 3 },
+  { "cularr;", "↶", 7, 3 },
+  { "cularrp;", "⤽", 8, 3 },
+  { "cup;", "∪", 4, 3 },
+  { "cupbrcap;", "⩈", 9, 3 },
+  { "cupcap;", "⩆", 7, 3 },
+  { "cupcup;", "⩊", 7, 3 },
+  { "cupdot;", "⊍", 7, 3 },
+  { "cupor;", "⩅", 6, 3 },
+  { "cups;", "∪\xEF\xB8\x80", 5, 6 },
+  { "curarr;", "↷", 7, 3 },
+  { "curarrm;", "⤼", 8, 3 },
+  { "curlyeqprec;", "⋞", 12, 3 },
+  { "curlyeqsucc;", "⋟", 12, 3 },
+  { "curlyvee;", "⋎", 9, 3 },
+  { "curlywedge;", "⋏", 11, 3 },
+  { "curren", "¤", 6, 2 },
+  { "curren;", "¤", 7, 2 },
+  { "curvearrowleft;", "↶", 15, 3 },
+  { "curvearrowright;", "↷", 16, 3 },
+  { "cuvee;", "⋎", 6, 3 },
+  { "cuwed;", "⋏", 6, 3 },
+  { "cwconint;", "∲", 9, 3 },
+  { "cwint;", "∱", 6, 3 },
+  { "cylcty;", "⌭", 7, 3 },
+  { "dArr;", "⇓", 5, 3 },
+  { "dHar;", "⥥", 5, 3 },
+  { "dagger;", "†", 7, 3 },
+  { "daleth;", "ℸ", 7, 3 },
+  { "darr;", "↓", 5, 3 },
+  { "dash;", "‐", 5, 3 },
+  { "dashv;", "⊣", 6, 3 },
+  { "dbkarow;", "⤏", 8, 3 },
+  { "dblac;", "˝", 6, 2 },
+  { "dcaron;", "ď", 7, 2 },
+  { "dcy;", "д", 4, 2 },
+  { "dd;", "ⅆ", 3, 3 },
+  { "ddagger;", "‡", 8, 3 },
+  { "ddarr;", "⇊", 6, 3 },
+  { "ddotseq;", "⩷", 8, 3 },
+  { "deg", "°", 3, 2 },
+  { "deg;", "°", 4, 2 },
+  { "delta;", "δ", 6, 2 },
+  { "demptyv;", "⦱", 8, 3 },
+  { "dfisht;", "⥿", 7, 3 },
+  { "dfr;", "𝔡", 4, 4 },
+  { "dharl;", "⇃", 6, 3 },
+  { "dharr;", "⇂", 6, 3 },
+  { "diam;", "⋄", 5, 3 },
+  { "diamond;", "⋄", 8, 3 },
+  { "diamondsuit;", "♦", 12, 3 },
+  { "diams;", "♦", 6, 3 },
+  { "die;", "¨", 4, 2 },
+  { "digamma;", "ϝ", 8, 2 },
+  { "disin;", "⋲", 6, 3 },
+  { "div;", "÷", 4, 2 },
+  { "divide", "÷", 6, 2 },
+  { "divide;", "÷", 7, 2 },
+  { "divideontimes;", "⋇", 14, 3 },
+  { "divonx;", "⋇", 7, 3 },
+  { "djcy;", "ђ", 5, 2 },
+  { "dlcorn;", "⌞", 7, 3 },
+  { "dlcrop;", "⌍", 7, 3 },
+  { "dollar;", "$", 7, 1 },
+  { "dopf;", "𝕕", 5, 4 },
+  { "dot;", "˙", 4, 2 },
+  { "doteq;", "≐", 6, 3 },
+  { "doteqdot;", "≑", 9, 3 },
+  { "dotminus;", "∸", 9, 3 },
+  { "dotplus;", "∔", 8, 3 },
+  { "dotsquare;", "⊡", 10, 3 },
+  { "doublebarwedge;", "⌆", 15, 3 },
+  { "downarrow;", "↓", 10, 3 },
+  { "downdownarrows;", "⇊", 15, 3 },
+  { "downharpoonleft;", "⇃", 16, 3 },
+  { "downharpoonright;", "⇂", 17, 3 },
+  { "drbkarow;", "⤐", 9, 3 },
+  { "drcorn;", "⌟", 7, 3 },
+  { "drcrop;", "⌌", 7, 3 },
+  { "dscr;", "𝒹", 5, 4 },
+  { "dscy;", "ѕ", 5, 2 },
+  { "dsol;", "⧶", 5, 3 },
+  { "dstrok;", "đ", 7, 2 },
+  { "dtdot;", "⋱", 6, 3 },
+  { "dtri;", "▿", 5, 3 },
+  { "dtrif;", "▾", 6, 3 },
+  { "duarr;", "⇵", 6, 3 },
+  { "duhar;", "⥯", 6, 3 },
+  { "dwangle;", "⦦", 8, 3 },
+  { "dzcy;", "џ", 5, 2 },
+  { "dzigrarr;", "⟿", 9, 3 },
+  { "eDDot;", "⩷", 6, 3 },
+  { "eDot;", "≑", 5, 3 },
+  { "eacute", "é", 6, 2 },
+  { "eacute;", "é", 7, 2 },
+  { "easter;", "⩮", 7, 3 },
+  { "ecaron;", "ě", 7, 2 },
+  { "ecir;", "≖", 5, 3 },
+  { "ecirc", "ê", 5, 2 },
+  { "ecirc;", "ê", 6, 2 },
+  { "ecolon;", "≕", 7, 3 },
+  { "ecy;", "э", 4, 2 },
+  { "edot;", "ė", 5, 2 },
+  { "ee;", "ⅇ", 3, 3 },
+  { "efDot;", "≒", 6, 3 },
+  { "efr;", "𝔢", 4, 4 },
+  { "eg;", "⪚", 3, 3 },
+  { "egrave", "è", 6, 2 },
+  { "egrave;", "è", 7, 2 },
+  { "egs;", "⪖", 4, 3 },
+  { "egsdot;", "⪘", 7, 3 },
+  { "el;", "⪙", 3, 3 },
+  { "elinters;", "⏧", 9, 3 },
+  { "ell;", "ℓ", 4, 3 },
+  { "els;", "⪕", 4, 3 },
+  { "elsdot;", "⪗", 7, 3 },
+  { "emacr;", "ē", 6, 2 },
+  { "empty;", "∅", 6, 3 },
+  { "emptyset;", "∅", 9, 3 },
+  { "emptyv;", "∅", 7, 3 },
+  { "emsp13;", "\xE2\x80\x84", 7, 3 },
+  { "emsp14;", "\xE2\x80\x85", 7, 3 },
+  { "emsp;", "\xE2\x80\x83", 5, 3 },
+  { "eng;", "ŋ", 4, 2 },
+  { "ensp;", "\xE2\x80\x82", 5, 3 },
+  { "eogon;", "ę", 6, 2 },
+  { "eopf;", "𝕖", 5, 4 },
+  { "epar;", "⋕", 5, 3 },
+  { "eparsl;", "⧣", 7, 3 },
+  { "eplus;", "⩱", 6, 3 },
+  { "epsi;", "ε", 5, 2 },
+  { "epsilon;", "ε", 8, 2 },
+  { "epsiv;", "ϵ", 6, 2 },
+  { "eqcirc;", "≖", 7, 3 },
+  { "eqcolon;", "≕", 8, 3 },
+  { "eqsim;", "≂", 6, 3 },
+  { "eqslantgtr;", "⪖", 11, 3 },
+  { "eqslantless;", "⪕", 12, 3 },
+  { "equals;", "=", 7, 1 },
+  { "equest;", "≟", 7, 3 },
+  { "equiv;", "≡", 6, 3 },
+  { "equivDD;", "⩸", 8, 3 },
+  { "eqvparsl;", "⧥", 9, 3 },
+  { "erDot;", "≓", 6, 3 },
+  { "erarr;", "⥱", 6, 3 },
+  { "escr;", "ℯ", 5, 3 },
+  { "esdot;", "≐", 6, 3 },
+  { "esim;", "≂", 5, 3 },
+  { "eta;", "η", 4, 2 },
+  { "eth", "ð", 3, 2 },
+  { "eth;", "ð", 4, 2 },
+  { "euml", "ë", 4, 2 },
+  { "euml;", "ë", 5, 2 },
+  { "euro;", "€", 5, 3 },
+  { "excl;", "!", 5, 1 },
+  { "exist;", "∃", 6, 3 },
+  { "expectation;", "ℰ", 12, 3 },
+  { "exponentiale;", "ⅇ", 13, 3 },
+  { "fallingdotseq;", "≒", 14, 3 },
+  { "fcy;", "ф", 4, 2 },
+  { "female;", "♀", 7, 3 },
+  { "ffilig;", "ﬃ", 7, 3 },
+  { "fflig;", "ﬀ", 6, 3 },
+  { "ffllig;", "ﬄ", 7, 3 },
+  { "ffr;", "𝔣", 4, 4 },
+  { "filig;", "ﬁ", 6, 3 },
+  { "fjlig;", "fj", 6, 2 },
+  { "flat;", "♭", 5, 3 },
+  { "fllig;", "ﬂ", 6, 3 },
+  { "fltns;", "▱", 6, 3 },
+  { "fnof;", "ƒ", 5, 2 },
+  { "fopf;", "𝕗", 5, 4 },
+  { "forall;", "∀", 7, 3 },
+  { "fork;", "⋔", 5, 3 },
+  { "forkv;", "⫙", 6, 3 },
+  { "fpartint;", "⨍", 9, 3 },
+  { "frac12", "½", 6, 2 },
+  { "frac12;", "½", 7, 2 },
+  { "frac13;", "⅓", 7, 3 },
+  { "frac14", "¼", 6, 2 },
+  { "frac14;", "¼", 7, 2 },
+  { "frac15;", "⅕", 7, 3 },
+  { "frac16;", "⅙", 7, 3 },
+  { "frac18;", "⅛", 7, 3 },
+  { "frac23;", "⅔", 7, 3 },
+  { "frac25;", "⅖", 7, 3 },
+  { "frac34", "¾", 6, 2 },
+  { "frac34;", "¾", 7, 2 },
+  { "frac35;", "⅗", 7, 3 },
+  { "frac38;", "⅜", 7, 3 },
+  { "frac45;", "⅘", 7, 3 },
+  { "frac56;", "⅚", 7, 3 },
+  { "frac58;", "⅝", 7, 3 },
+  { "frac78;", "⅞", 7, 3 },
+  { "frasl;", "⁄", 6, 3 },
+  { "frown;", "⌢", 6, 3 },
+  { "fscr;", "𝒻", 5, 4 },
+  { "gE;", "≧", 3, 3 },
+  { "gEl;", "⪌", 4, 3 },
+  { "gacute;", "ǵ", 7, 2 },
+  { "gamma;", "γ", 6, 2 },
+  { "gammad;", "ϝ", 7, 2 },
+  { "gap;", "⪆", 4, 3 },
+  { "gbreve;", "ğ", 7, 2 },
+  { "gcirc;", "ĝ", 6, 2 },
+  { "gcy;", "г", 4, 2 },
+  { "gdot;", "ġ", 5, 2 },
+  { "ge;", "≥", 3, 3 },
+  { "gel;", "⋛", 4, 3 },
+  { "geq;", "≥", 4, 3 },
+  { "geqq;", "≧", 5, 3 },
+  { "geqslant;", "⩾", 9, 3 },
+  { "ges;", "⩾", 4, 3 },
+  { "gescc;", "⪩", 6, 3 },
+  { "gesdot;", "⪀", 7, 3 },
+  { "gesdoto;", "⪂", 8, 3 },
+  { "gesdotol;", "⪄", 9, 3 },
+  { "gesl;", "⋛\xEF\xB8\x80", 5, 6 },
+  { "gesles;", "⪔", 7, 3 },
+  { "gfr;", "𝔤", 4, 4 },
+  { "gg;", "≫", 3, 3 },
+  { "ggg;", "⋙", 4, 3 },
+  { "gimel;", "ℷ", 6, 3 },
+  { "gjcy;", "ѓ", 5, 2 },
+  { "gl;", "≷", 3, 3 },
+  { "glE;", "⪒", 4, 3 },
+  { "gla;", "⪥", 4, 3 },
+  { "glj;", "⪤", 4, 3 },
+  { "gnE;", "≩", 4, 3 },
+  { "gnap;", "⪊", 5, 3 },
+  { "gnapprox;", "⪊", 9, 3 },
+  { "gne;", "⪈", 4, 3 },
+  { "gneq;", "⪈", 5, 3 },
+  { "gneqq;", "≩", 6, 3 },
+  { "gnsim;", "⋧", 6, 3 },
+  { "gopf;", "𝕘", 5, 4 },
+  { "grave;", "`", 6, 1 },
+  { "gscr;", "ℊ", 5, 3 },
+  { "gsim;", "≳", 5, 3 },
+  { "gsime;", "⪎", 6, 3 },
+  { "gsiml;", "⪐", 6, 3 },
+  { "gt", ">", 2, 1 },
+  { "gt;", ">", 3, 1 },
+  { "gtcc;", "⪧", 5, 3 },
+  { "gtcir;", "⩺", 6, 3 },
+  { "gtdot;", "⋗", 6, 3 },
+  { "gtlPar;", "⦕", 7, 3 },
+  { "gtquest;", "⩼", 8, 3 },
+  { "gtrapprox;", "⪆", 10, 3 },
+  { "gtrarr;", "⥸", 7, 3 },
+  { "gtrdot;", "⋗", 7, 3 },
+  { "gtreqless;", "⋛", 10, 3 },
+  { "gtreqqless;", "⪌", 11, 3 },
+  { "gtrless;", "≷", 8, 3 },
+  { "gtrsim;", "≳", 7, 3 },
+  { "gvertneqq;", "≩\xEF\xB8\x80", 10, 6 },
+  { "gvnE;", "≩\xEF\xB8\x80", 5, 6 },
+  { "hArr;", "⇔", 5, 3 },
+  { "hairsp;", "\xE2\x80\x8A", 7, 3 },
+  { "half;", "½", 5, 2 },
+  { "hamilt;", "ℋ", 7, 3 },
+  { "hardcy;", "ъ", 7, 2 },
+  { "harr;", "↔", 5, 3 },
+  { "harrcir;", "⥈", 8, 3 },
+  { "harrw;", "↭", 6, 3 },
+  { "hbar;", "ℏ", 5, 3 },
+  { "hcirc;", "ĥ", 6, 2 },
+  { "hearts;", "♥", 7, 3 },
+  { "heartsuit;", "♥", 10, 3 },
+  { "hellip;", "…", 7, 3 },
+  { "hercon;", "⊹", 7, 3 },
+  { "hfr;", "𝔥", 4, 4 },
+  { "hksearow;", "⤥", 9, 3 },
+  { "hkswarow;", "⤦", 9, 3 },
+  { "hoarr;", "⇿", 6, 3 },
+  { "homtht;", "∻", 7, 3 },
+  { "hookleftarrow;", "↩", 14, 3 },
+  { "hookrightarrow;", "↪", 15, 3 },
+  { "hopf;", "𝕙", 5, 4 },
+  { "horbar;", "―", 7, 3 },
+  { "hscr;", "𝒽", 5, 4 },
+  { "hslash;", "ℏ", 7, 3 },
+  { "hstrok;", "ħ", 7, 2 },
+  { "hybull;", "⁃", 7, 3 },
+  { "hyphen;", "‐", 7, 3 },
+  { "iacute", "í", 6, 2 },
+  { "iacute;", "í", 7, 2 },
+  { "ic;", "\xE2\x81\xA3", 3, 3 },
+  { "icirc", "î", 5, 2 },
+  { "icirc;", "î", 6, 2 },
+  { "icy;", "и", 4, 2 },
+  { "iecy;", "е", 5, 2 },
+  { "iexcl", "¡", 5, 2 },
+  { "iexcl;", "¡", 6, 2 },
+  { "iff;", "⇔", 4, 3 },
+  { "ifr;", "𝔦", 4, 4 },
+  { "igrave", "ì", 6, 2 },
+  { "igrave;", "ì", 7, 2 },
+  { "ii;", "ⅈ", 3, 3 },
+  { "iiiint;", "⨌", 7, 3 },
+  { "iiint;", "∭", 6, 3 },
+  { "iinfin;", "⧜", 7, 3 },
+  { "iiota;", "℩", 6, 3 },
+  { "ijlig;", "ĳ", 6, 2 },
+  { "imacr;", "ī", 6, 2 },
+  { "image;", "ℑ", 6, 3 },
+  { "imagline;", "ℐ", 9, 3 },
+  { "imagpart;", "ℑ", 9, 3 },
+  { "imath;", "ı", 6, 2 },
+  { "imof;", "⊷", 5, 3 },
+  { "imped;", "Ƶ", 6, 2 },
+  { "in;", "∈", 3, 3 },
+  { "incare;", "℅", 7, 3 },
+  { "infin;", "∞", 6, 3 },
+  { "infintie;", "⧝", 9, 3 },
+  { "inodot;", "ı", 7, 2 },
+  { "int;", "∫", 4, 3 },
+  { "intcal;", "⊺", 7, 3 },
+  { "integers;", "ℤ", 9, 3 },
+  { "intercal;", "⊺", 9, 3 },
+  { "intlarhk;", "⨗", 9, 3 },
+  { "intprod;", "⨼", 8, 3 },
+  { "iocy;", "ё", 5, 2 },
+  { "iogon;", "į", 6, 2 },
+  { "iopf;", "𝕚", 5, 4 },
+  { "iota;", "ι", 5, 2 },
+  { "iprod;", "⨼", 6, 3 },
+  { "iquest", "¿", 6, 2 },
+  { "iquest;", "¿", 7, 2 },
+  { "iscr;", "𝒾", 5, 4 },
+  { "isin;", "∈", 5, 3 },
+  { "isinE;", "⋹", 6, 3 },
+  { "isindot;", "⋵", 8, 3 },
+  { "isins;", "⋴", 6, 3 },
+  { "isinsv;", "⋳", 7, 3 },
+  { "isinv;", "∈", 6, 3 },
+  { "it;", "\xE2\x81\xA2", 3, 3 },
+  { "itilde;", "ĩ", 7, 2 },
+  { "iukcy;", "і", 6, 2 },
+  { "iuml", "ï", 4, 2 },
+  { "iuml;", "ï", 5, 2 },
+  { "jcirc;", "ĵ", 6, 2 },
+  { "jcy;", "й", 4, 2 },
+  { "jfr;", "𝔧", 4, 4 },
+  { "jmath;", "ȷ", 6, 2 },
+  { "jopf;", "𝕛", 5, 4 },
+  { "jscr;", "𝒿", 5, 4 },
+  { "jsercy;", "ј", 7, 2 },
+  { "jukcy;", "є", 6, 2 },
+  { "kappa;", "κ", 6, 2 },
+  { "kappav;", "ϰ", 7, 2 },
+  { "kcedil;", "ķ", 7, 2 },
+  { "kcy;", "к", 4, 2 },
+  { "kfr;", "𝔨", 4, 4 },
+  { "kgreen;", "ĸ", 7, 2 },
+  { "khcy;", "х", 5, 2 },
+  { "kjcy;", "ќ", 5, 2 },
+  { "kopf;", "𝕜", 5, 4 },
+  { "kscr;", "𝓀", 5, 4 },
+  { "lAarr;", "⇚", 6, 3 },
+  { "lArr;", "⇐", 5, 3 },
+  { "lAtail;", "⤛", 7, 3 },
+  { "lBarr;", "⤎", 6, 3 },
+  { "lE;", "≦", 3, 3 },
+  { "lEg;", "⪋", 4, 3 },
+  { "lHar;", "⥢", 5, 3 },
+  { "lacute;", "ĺ", 7, 2 },
+  { "laemptyv;", "⦴", 9, 3 },
+  { "lagran;", "ℒ", 7, 3 },
+  { "lambda;", "λ", 7, 2 },
+  { "lang;", "⟨", 5, 3 },
+  { "langd;", "⦑", 6, 3 },
+  { "langle;", "⟨", 7, 3 },
+  { "lap;", "⪅", 4, 3 },
+  { "laquo", "«", 5, 2 },
+  { "laquo;", "«", 6, 2 },
+  { "larr;", "←", 5, 3 },
+  { "larrb;", "⇤", 6, 3 },
+  { "larrbfs;", "⤟", 8, 3 },
+  { "larrfs;", "⤝", 7, 3 },
+  { "larrhk;", "↩", 7, 3 },
+  { "larrlp;", "↫", 7, 3 },
+  { "larrpl;", "⤹", 7, 3 },
+  { "larrsim;", "⥳", 8, 3 },
+  { "larrtl;", "↢", 7, 3 },
+  { "lat;", "⪫", 4, 3 },
+  { "latail;", "⤙", 7, 3 },
+  { "late;", "⪭", 5, 3 },
+  { "lates;", "⪭\xEF\xB8\x80", 6, 6 },
+  { "lbarr;", "⤌", 6, 3 },
+  { "lbbrk;", "❲", 6, 3 },
+  { "lbrace;", "{", 7, 1 },
+  { "lbrack;", "[", 7, 1 },
+  { "lbrke;", "⦋", 6, 3 },
+  { "lbrksld;", "⦏", 8, 3 },
+  { "lbrkslu;", "⦍", 8, 3 },
+  { "lcaron;", "ľ", 7, 2 },
+  { "lcedil;", "ļ", 7, 2 },
+  { "lceil;", "⌈", 6, 3 },
+  { "lcub;", "{", 5, 1 },
+  { "lcy;", "л", 4, 2 },
+  { "ldca;", "⤶", 5, 3 },
+  { "ldquo;", "“", 6, 3 },
+  { "ldquor;", "„", 7, 3 },
+  { "ldrdhar;", "⥧", 8, 3 },
+  { "ldrushar;", "⥋", 9, 3 },
+  { "ldsh;", "↲", 5, 3 },
+  { "le;", "≤", 3, 3 },
+  { "leftarrow;", "←", 10, 3 },
+  { "leftarrowtail;", "↢", 14, 3 },
+  { "leftharpoondown;", "↽", 16, 3 },
+  { "leftharpoonup;", "↼", 14, 3 },
+  { "leftleftarrows;", "⇇", 15, 3 },
+  { "leftrightarrow;", "↔", 15, 3 },
+  { "leftrightarrows;", "⇆", 16, 3 },
+  { "leftrightharpoons;", "⇋", 18, 3 },
+  { "leftrightsquigarrow;", "↭", 20, 3 },
+  { "leftthreetimes;", "⋋", 15, 3 },
+  { "leg;", "⋚", 4, 3 },
+  { "leq;", "≤", 4, 3 },
+  { "leqq;", "≦", 5, 3 },
+  { "leqslant;", "⩽", 9, 3 },
+  { "les;", "⩽", 4, 3 },
+  { "lescc;", "⪨", 6, 3 },
+  { "lesdot;", "⩿", 7, 3 },
+  { "lesdoto;", "⪁", 8, 3 },
+  { "lesdotor;", "⪃", 9, 3 },
+  { "lesg;", "⋚\xEF\xB8\x80", 5, 6 },
+  { "lesges;", "⪓", 7, 3 },
+  { "lessapprox;", "⪅", 11, 3 },
+  { "lessdot;", "⋖", 8, 3 },
+  { "lesseqgtr;", "⋚", 10, 3 },
+  { "lesseqqgtr;", "⪋", 11, 3 },
+  { "lessgtr;", "≶", 8, 3 },
+  { "lesssim;", "≲", 8, 3 },
+  { "lfisht;", "⥼", 7, 3 },
+  { "lfloor;", "⌊", 7, 3 },
+  { "lfr;", "𝔩", 4, 4 },
+  { "lg;", "≶", 3, 3 },
+  { "lgE;", "⪑", 4, 3 },
+  { "lhard;", "↽", 6, 3 },
+  { "lharu;", "↼", 6, 3 },
+  { "lharul;", "⥪", 7, 3 },
+  { "lhblk;", "▄", 6, 3 },
+  { "ljcy;", "љ", 5, 2 },
+  { "ll;", "≪", 3, 3 },
+  { "llarr;", "⇇", 6, 3 },
+  { "llcorner;", "⌞", 9, 3 },
+  { "llhard;", "⥫", 7, 3 },
+  { "lltri;", "◺", 6, 3 },
+  { "lmidot;", "ŀ", 7, 2 },
+  { "lmoust;", "⎰", 7, 3 },
+  { "lmoustache;", "⎰", 11, 3 },
+  { "lnE;", "≨", 4, 3 },
+  { "lnap;", "⪉", 5, 3 },
+  { "lnapprox;", "⪉", 9, 3 },
+  { "lne;", "⪇", 4, 3 },
+  { "lneq;", "⪇", 5, 3 },
+  { "lneqq;", "≨", 6, 3 },
+  { "lnsim;", "⋦", 6, 3 },
+  { "loang;", "⟬", 6, 3 },
+  { "loarr;", "⇽", 6, 3 },
+  { "lobrk;", "⟦", 6, 3 },
+  { "longleftarrow;", "⟵", 14, 3 },
+  { "longleftrightarrow;", "⟷", 19, 3 },
+  { "longmapsto;", "⟼", 11, 3 },
+  { "longrightarrow;", "⟶", 15, 3 },
+  { "looparrowleft;", "↫", 14, 3 },
+  { "looparrowright;", "↬", 15, 3 },
+  { "lopar;", "⦅", 6, 3 },
+  { "lopf;", "𝕝", 5, 4 },
+  { "loplus;", "⨭", 7, 3 },
+  { "lotimes;", "⨴", 8, 3 },
+  { "lowast;", "∗", 7, 3 },
+  { "lowbar;", "_", 7, 1 },
+  { "loz;", "◊", 4, 3 },
+  { "lozenge;", "◊", 8, 3 },
+  { "lozf;", "⧫", 5, 3 },
+  { "lpar;", "(", 5, 1 },
+  { "lparlt;", "⦓", 7, 3 },
+  { "lrarr;", "⇆", 6, 3 },
+  { "lrcorner;", "⌟", 9, 3 },
+  { "lrhar;", "⇋", 6, 3 },
+  { "lrhard;", "⥭", 7, 3 },
+  { "lrm;", "\xE2\x80\x8E", 4, 3 },
+  { "lrtri;", "⊿", 6, 3 },
+  { "lsaquo;", "‹", 7, 3 },
+  { "lscr;", "𝓁", 5, 4 },
+  { "lsh;", "↰", 4, 3 },
+  { "lsim;", "≲", 5, 3 },
+  { "lsime;", "⪍", 6, 3 },
+  { "lsimg;", "⪏", 6, 3 },
+  { "lsqb;", "[", 5, 1 },
+  { "lsquo;", "‘", 6, 3 },
+  { "lsquor;", "‚", 7, 3 },
+  { "lstrok;", "ł", 7, 2 },
+  { "lt", "<", 2, 1 },
+  { "lt;", "<", 3, 1 },
+  { "ltcc;", "⪦", 5, 3 },
+  { "ltcir;", "⩹", 6, 3 },
+  { "ltdot;", "⋖", 6, 3 },
+  { "lthree;", "⋋", 7, 3 },
+  { "ltimes;", "⋉", 7, 3 },
+  { "ltlarr;", "⥶", 7, 3 },
+  { "ltquest;", "⩻", 8, 3 },
+  { "ltrPar;", "⦖", 7, 3 },
+  { "ltri;", "◃", 5, 3 },
+  { "ltrie;", "⊴", 6, 3 },
+  { "ltrif;", "◂", 6, 3 },
+  { "lurdshar;", "⥊", 9, 3 },
+  { "luruhar;", "⥦", 8, 3 },
+  { "lvertneqq;", "≨\xEF\xB8\x80", 10, 6 },
+  { "lvnE;", "≨\xEF\xB8\x80", 5, 6 },
+  { "mDDot;", "∺", 6, 3 },
+  { "macr", "¯", 4, 2 },
+  { "macr;", "¯", 5, 2 },
+  { "male;", "♂", 5, 3 },
+  { "malt;", "✠", 5, 3 },
+  { "maltese;", "✠", 8, 3 },
+  { "map;", "↦", 4, 3 },
+  { "mapsto;", "↦", 7, 3 },
+  { "mapstodown;", "↧", 11, 3 },
+  { "mapstoleft;", "↤", 11, 3 },
+  { "mapstoup;", "↥", 9, 3 },
+  { "marker;", "▮", 7, 3 },
+  { "mcomma;", "⨩", 7, 3 },
+  { "mcy;", "м", 4, 2 },
+  { "mdash;", "—", 6, 3 },
+  { "measuredangle;", "∡", 14, 3 },
+  { "mfr;", "𝔪", 4, 4 },
+  { "mho;", "℧", 4, 3 },
+  { "micro", "µ", 5, 2 },
+  { "micro;", "µ", 6, 2 },
+  { "mid;", "∣", 4, 3 },
+  { "midast;", "*", 7, 1 },
+  { "midcir;", "⫰", 7, 3 },
+  { "middot", "·", 6, 2 },
+  { "middot;", "·", 7, 2 },
+  { "minus;", "−", 6, 3 },
+  { "minusb;", "⊟", 7, 3 },
+  { "minusd;", "∸", 7, 3 },
+  { "minusdu;", "⨪", 8, 3 },
+  { "mlcp;", "⫛", 5, 3 },
+  { "mldr;", "…", 5, 3 },
+  { "mnplus;", "∓", 7, 3 },
+  { "models;", "⊧", 7, 3 },
+  { "mopf;", "𝕞", 5, 4 },
+  { "mp;", "∓", 3, 3 },
+  { "mscr;", "𝓂", 5, 4 },
+  { "mstpos;", "∾", 7, 3 },
+  { "mu;", "μ", 3, 2 },
+  { "multimap;", "⊸", 9, 3 },
+  { "mumap;", "⊸", 6, 3 },
+  { "nGg;", "⋙\xCC\xB8", 4, 5 },
+  { "nGt;", "≫\xE2\x83\x92", 4, 6 },
+  { "nGtv;", "≫\xCC\xB8", 5, 5 },
+  { "nLeftarrow;", "⇍", 11, 3 },
+  { "nLeftrightarrow;", "⇎", 16, 3 },
+  { "nLl;", "⋘\xCC\xB8", 4, 5 },
+  { "nLt;", "≪\xE2\x83\x92", 4, 6 },
+  { "nLtv;", "≪\xCC\xB8", 5, 5 },
+  { "nRightarrow;", "⇏", 12, 3 },
+  { "nVDash;", "⊯", 7, 3 },
+  { "nVdash;", "⊮", 7, 3 },
+  { "nabla;", "∇", 6, 3 },
+  { "nacute;", "ń", 7, 2 },
+  { "nang;", "∠\xE2\x83\x92", 5, 6 },
+  { "nap;", "≉", 4, 3 },
+  { "napE;", "⩰\xCC\xB8", 5, 5 },
+  { "napid;", "≋\xCC\xB8", 6, 5 },
+  { "napos;", "ŉ", 6, 2 },
+  { "napprox;", "≉", 8, 3 },
+  { "natur;", "♮", 6, 3 },
+  { "natural;", "♮", 8, 3 },
+  { "naturals;", "ℕ", 9, 3 },
+  { "nbsp", "\xC2\xA0", 4, 2 },
+  { "nbsp;", "\xC2\xA0", 5, 2 },
+  { "nbump;", "≎\xCC\xB8", 6, 5 },
+  { "nbumpe;", "≏\xCC\xB8", 7, 5 },
+  { "ncap;", "⩃", 5, 3 },
+  { "ncaron;", "ň", 7, 2 },
+  { "ncedil;", "ņ", 7, 2 },
+  { "ncong;", "≇", 6, 3 },
+  { "ncongdot;", "⩭\xCC\xB8", 9, 5 },
+  { "ncup;", "⩂", 5, 3 },
+  { "ncy;", "н", 4, 2 },
+  { "ndash;", "–", 6, 3 },
+  { "ne;", "≠", 3, 3 },
+  { "neArr;", "⇗", 6, 3 },
+  { "nearhk;", "⤤", 7, 3 },
+  { "nearr;", "↗", 6, 3 },
+  { "nearrow;", "↗", 8, 3 },
+  { "nedot;", "≐\xCC\xB8", 6, 5 },
+  { "nequiv;", "≢", 7, 3 },
+  { "nesear;", "⤨", 7, 3 },
+  { "nesim;", "≂\xCC\xB8", 6, 5 },
+  { "nexist;", "∄", 7, 3 },
+  { "nexists;", "∄", 8, 3 },
+  { "nfr;", "𝔫", 4, 4 },
+  { "ngE;", "≧\xCC\xB8", 4, 5 },
+  { "nge;", "≱", 4, 3 },
+  { "ngeq;", "≱", 5, 3 },
+  { "ngeqq;", "≧\xCC\xB8", 6, 5 },
+  { "ngeqslant;", "⩾\xCC\xB8", 10, 5 },
+  { "nges;", "⩾\xCC\xB8", 5, 5 },
+  { "ngsim;", "≵", 6, 3 },
+  { "ngt;", "≯", 4, 3 },
+  { "ngtr;", "≯", 5, 3 },
+  { "nhArr;", "⇎", 6, 3 },
+  { "nharr;", "↮", 6, 3 },
+  { "nhpar;", "⫲", 6, 3 },
+  { "ni;", "∋", 3, 3 },
+  { "nis;", "⋼", 4, 3 },
+  { "nisd;", "⋺", 5, 3 },
+  { "niv;", "∋", 4, 3 },
+  { "njcy;", "њ", 5, 2 },
+  { "nlArr;", "⇍", 6, 3 },
+  { "nlE;", "≦\xCC\xB8", 4, 5 },
+  { "nlarr;", "↚", 6, 3 },
+  { "nldr;", "‥", 5, 3 },
+  { "nle;", "≰", 4, 3 },
+  { "nleftarrow;", "↚", 11, 3 },
+  { "nleftrightarrow;", "↮", 16, 3 },
+  { "nleq;", "≰", 5, 3 },
+  { "nleqq;", "≦\xCC\xB8", 6, 5 },
+  { "nleqslant;", "⩽\xCC\xB8", 10, 5 },
+  { "nles;", "⩽\xCC\xB8", 5, 5 },
+  { "nless;", "≮", 6, 3 },
+  { "nlsim;", "≴", 6, 3 },
+  { "nlt;", "≮", 4, 3 },
+  { "nltri;", "⋪", 6, 3 },
+  { "nltrie;", "⋬", 7, 3 },
+  { "nmid;", "∤", 5, 3 },
+  { "nopf;", "𝕟", 5, 4 },
+  { "not", "¬", 3, 2 },
+  { "not;", "¬", 4, 2 },
+  { "notin;", "∉", 6, 3 },
+  { "notinE;", "⋹\xCC\xB8", 7, 5 },
+  { "notindot;", "⋵\xCC\xB8", 9, 5 },
+  { "notinva;", "∉", 8, 3 },
+  { "notinvb;", "⋷", 8, 3 },
+  { "notinvc;", "⋶", 8, 3 },
+  { "notni;", "∌", 6, 3 },
+  { "notniva;", "∌", 8, 3 },
+  { "notnivb;", "⋾", 8, 3 },
+  { "notnivc;", "⋽", 8, 3 },
+  { "npar;", "∦", 5, 3 },
+  { "nparallel;", "∦", 10, 3 },
+  { "nparsl;", "⫽\xE2\x83\xA5", 7, 6 },
+  { "npart;", "∂\xCC\xB8", 6, 5 },
+  { "npolint;", "⨔", 8, 3 },
+  { "npr;", "⊀", 4, 3 },
+  { "nprcue;", "⋠", 7, 3 },
+  { "npre;", "⪯\xCC\xB8", 5, 5 },
+  { "nprec;", "⊀", 6, 3 },
+  { "npreceq;", "⪯\xCC\xB8", 8, 5 },
+  { "nrArr;", "⇏", 6, 3 },
+  { "nrarr;", "↛", 6, 3 },
+  { "nrarrc;", "⤳\xCC\xB8", 7, 5 },
+  { "nrarrw;", "↝\xCC\xB8", 7, 5 },
+  { "nrightarrow;", "↛", 12, 3 },
+  { "nrtri;", "⋫", 6, 3 },
+  { "nrtrie;", "⋭", 7, 3 },
+  { "nsc;", "⊁", 4, 3 },
+  { "nsccue;", "⋡", 7, 3 },
+  { "nsce;", "⪰\xCC\xB8", 5, 5 },
+  { "nscr;", "𝓃", 5, 4 },
+  { "nshortmid;", "∤", 10, 3 },
+  { "nshortparallel;", "∦", 15, 3 },
+  { "nsim;", "≁", 5, 3 },
+  { "nsime;", "≄", 6, 3 },
+  { "nsimeq;", "≄", 7, 3 },
+  { "nsmid;", "∤", 6, 3 },
+  { "nspar;", "∦", 6, 3 },
+  { "nsqsube;", "⋢", 8, 3 },
+  { "nsqsupe;", "⋣", 8, 3 },
+  { "nsub;", "⊄", 5, 3 },
+  { "nsubE;", "⫅\xCC\xB8", 6, 5 },
+  { "nsube;", "⊈", 6, 3 },
+  { "nsubset;", "⊂\xE2\x83\x92", 8, 6 },
+  { "nsubseteq;", "⊈", 10, 3 },
+  { "nsubseteqq;", "⫅\xCC\xB8", 11, 5 },
+  { "nsucc;", "⊁", 6, 3 },
+  { "nsucceq;", "⪰\xCC\xB8", 8, 5 },
+  { "nsup;", "⊅", 5, 3 },
+  { "nsupE;", "⫆\xCC\xB8", 6, 5 },
+  { "nsupe;", "⊉", 6, 3 },
+  { "nsupset;", "⊃\xE2\x83\x92", 8, 6 },
+  { "nsupseteq;", "⊉", 10, 3 },
+  { "nsupseteqq;", "⫆\xCC\xB8", 11, 5 },
+  { "ntgl;", "≹", 5, 3 },
+  { "ntilde", "ñ", 6, 2 },
+  { "ntilde;", "ñ", 7, 2 },
+  { "ntlg;", "≸", 5, 3 },
+  { "ntriangleleft;", "⋪", 14, 3 },
+  { "ntrianglelefteq;", "⋬", 16, 3 },
+  { "ntriangleright;", "⋫", 15, 3 },
+  { "ntrianglerighteq;", "⋭", 17, 3 },
+  { "nu;", "ν", 3, 2 },
+  { "num;", "#", 4, 1 },
+  { "numero;", "№", 7, 3 },
+  { "numsp;", "\xE2\x80\x87", 6, 3 },
+  { "nvDash;", "⊭", 7, 3 },
+  { "nvHarr;", "⤄", 7, 3 },
+  { "nvap;", "≍\xE2\x83\x92", 5, 6 },
+  { "nvdash;", "⊬", 7, 3 },
+  { "nvge;", "≥\xE2\x83\x92", 5, 6 },
+  { "nvgt;", ">\xE2\x83\x92", 5, 4 },
+  { "nvinfin;", "⧞", 8, 3 },
+  { "nvlArr;", "⤂", 7, 3 },
+  { "nvle;", "≤\xE2\x83\x92", 5, 6 },
+  { "nvlt;", "<\xE2\x83\x92", 5, 4 },
+  { "nvltrie;", "⊴\xE2\x83\x92", 8, 6 },
+  { "nvrArr;", "⤃", 7, 3 },
+  { "nvrtrie;", "⊵\xE2\x83\x92", 8, 6 },
+  { "nvsim;", "∼\xE2\x83\x92", 6, 6 },
+  { "nwArr;", "⇖", 6, 3 },
+  { "nwarhk;", "⤣", 7, 3 },
+  { "nwarr;", "↖", 6, 3 },
+  { "nwarrow;", "↖", 8, 3 },
+  { "nwnear;", "⤧", 7, 3 },
+  { "oS;", "Ⓢ", 3, 3 },
+  { "oacute", "ó", 6, 2 },
+  { "oacute;", "ó", 7, 2 },
+  { "oast;", "⊛", 5, 3 },
+  { "ocir;", "⊚", 5, 3 },
+  { "ocirc", "ô", 5, 2 },
+  { "ocirc;", "ô", 6, 2 },
+  { "ocy;", "о", 4, 2 },
+  { "odash;", "⊝", 6, 3 },
+  { "odblac;", "ő", 7, 2 },
+  { "odiv;", "⨸", 5, 3 },
+  { "odot;", "⊙", 5, 3 },
+  { "odsold;", "⦼", 7, 3 },
+  { "oelig;", "œ", 6, 2 },
+  { "ofcir;", "⦿", 6, 3 },
+  { "ofr;", "𝔬", 4, 4 },
+  { "ogon;", "˛", 5, 2 },
+  { "ograve", "ò", 6, 2 },
+  { "ograve;", "ò", 7, 2 },
+  { "ogt;", "⧁", 4, 3 },
+  { "ohbar;", "⦵", 6, 3 },
+  { "ohm;", "Ω", 4, 2 },
+  { "oint;", "∮", 5, 3 },
+  { "olarr;", "↺", 6, 3 },
+  { "olcir;", "⦾", 6, 3 },
+  { "olcross;", "⦻", 8, 3 },
+  { "oline;", "‾", 6, 3 },
+  { "olt;", "⧀", 4, 3 },
+  { "omacr;", "ō", 6, 2 },
+  { "omega;", "ω", 6, 2 },
+  { "omicron;", "ο", 8, 2 },
+  { "omid;", "⦶", 5, 3 },
+  { "ominus;", "⊖", 7, 3 },
+  { "oopf;", "𝕠", 5, 4 },
+  { "opar;", "⦷", 5, 3 },
+  { "operp;", "⦹", 6, 3 },
+  { "oplus;", "⊕", 6, 3 },
+  { "or;", "∨", 3, 3 },
+  { "orarr;", "↻", 6, 3 },
+  { "ord;", "⩝", 4, 3 },
+  { "order;", "ℴ", 6, 3 },
+  { "orderof;", "ℴ", 8, 3 },
+  { "ordf", "ª", 4, 2 },
+  { "ordf;", "ª", 5, 2 },
+  { "ordm", "º", 4, 2 },
+  { "ordm;", "º", 5, 2 },
+  { "origof;", "⊶", 7, 3 },
+  { "oror;", "⩖", 5, 3 },
+  { "orslope;", "⩗", 8, 3 },
+  { "orv;", "⩛", 4, 3 },
+  { "oscr;", "ℴ", 5, 3 },
+  { "oslash", "ø", 6, 2 },
+  { "oslash;", "ø", 7, 2 },
+  { "osol;", "⊘", 5, 3 },
+  { "otilde", "õ", 6, 2 },
+  { "otilde;", "õ", 7, 2 },
+  { "otimes;", "⊗", 7, 3 },
+  { "otimesas;", "⨶", 9, 3 },
+  { "ouml", "ö", 4, 2 },
+  { "ouml;", "ö", 5, 2 },
+  { "ovbar;", "⌽", 6, 3 },
+  { "par;", "∥", 4, 3 },
+  { "para", "¶", 4, 2 },
+  { "para;", "¶", 5, 2 },
+  { "parallel;", "∥", 9, 3 },
+  { "parsim;", "⫳", 7, 3 },
+  { "parsl;", "⫽", 6, 3 },
+  { "part;", "∂", 5, 3 },
+  { "pcy;", "п", 4, 2 },
+  { "percnt;", "%", 7, 1 },
+  { "period;", ".", 7, 1 },
+  { "permil;", "‰", 7, 3 },
+  { "perp;", "⊥", 5, 3 },
+  { "pertenk;", "‱", 8, 3 },
+  { "pfr;", "𝔭", 4, 4 },
+  { "phi;", "φ", 4, 2 },
+  { "phiv;", "ϕ", 5, 2 },
+  { "phmmat;", "ℳ", 7, 3 },
+  { "phone;", "☎", 6, 3 },
+  { "pi;", "π", 3, 2 },
+  { "pitchfork;", "⋔", 10, 3 },
+  { "piv;", "ϖ", 4, 2 },
+  { "planck;", "ℏ", 7, 3 },
+  { "planckh;", "ℎ", 8, 3 },
+  { "plankv;", "ℏ", 7, 3 },
+  { "plus;", "+", 5, 1 },
+  { "plusacir;", "⨣", 9, 3 },
+  { "plusb;", "⊞", 6, 3 },
+  { "pluscir;", "⨢", 8, 3 },
+  { "plusdo;", "∔", 7, 3 },
+  { "plusdu;", "⨥", 7, 3 },
+  { "pluse;", "⩲", 6, 3 },
+  { "plusmn", "±", 6, 2 },
+  { "plusmn;", "±", 7, 2 },
+  { "plussim;", "⨦", 8, 3 },
+  { "plustwo;", "⨧", 8, 3 },
+  { "pm;", "±", 3, 2 },
+  { "pointint;", "⨕", 9, 3 },
+  { "popf;", "𝕡", 5, 4 },
+  { "pound", "£", 5, 2 },
+  { "pound;", "£", 6, 2 },
+  { "pr;", "≺", 3, 3 },
+  { "prE;", "⪳", 4, 3 },
+  { "prap;", "⪷", 5, 3 },
+  { "prcue;", "≼", 6, 3 },
+  { "pre;", "⪯", 4, 3 },
+  { "prec;", "≺", 5, 3 },
+  { "precapprox;", "⪷", 11, 3 },
+  { "preccurlyeq;", "≼", 12, 3 },
+  { "preceq;", "⪯", 7, 3 },
+  { "precnapprox;", "⪹", 12, 3 },
+  { "precneqq;", "⪵", 9, 3 },
+  { "precnsim;", "⋨", 9, 3 },
+  { "precsim;", "≾", 8, 3 },
+  { "prime;", "′", 6, 3 },
+  { "primes;", "ℙ", 7, 3 },
+  { "prnE;", "⪵", 5, 3 },
+  { "prnap;", "⪹", 6, 3 },
+  { "prnsim;", "⋨", 7, 3 },
+  { "prod;", "∏", 5, 3 },
+  { "profalar;", "⌮", 9, 3 },
+  { "profline;", "⌒", 9, 3 },
+  { "profsurf;", "⌓", 9, 3 },
+  { "prop;", "∝", 5, 3 },
+  { "propto;", "∝", 7, 3 },
+  { "prsim;", "≾", 6, 3 },
+  { "prurel;", "⊰", 7, 3 },
+  { "pscr;", "𝓅", 5, 4 },
+  { "psi;", "ψ", 4, 2 },
+  { "puncsp;", "\xE2\x80\x88", 7, 3 },
+  { "qfr;", "𝔮", 4, 4 },
+  { "qint;", "⨌", 5, 3 },
+  { "qopf;", "𝕢", 5, 4 },
+  { "qprime;", "⁗", 7, 3 },
+  { "qscr;", "𝓆", 5, 4 },
+  { "quaternions;", "ℍ", 12, 3 },
+  { "quatint;", "⨖", 8, 3 },
+  { "quest;", "?", 6, 1 },
+  { "questeq;", "≟", 8, 3 },
+  { "quot", "\"", 4, 1 },
+  { "quot;", "\"", 5, 1 },
+  { "rAarr;", "⇛", 6, 3 },
+  { "rArr;", "⇒", 5, 3 },
+  { "rAtail;", "⤜", 7, 3 },
+  { "rBarr;", "⤏", 6, 3 },
+  { "rHar;", "⥤", 5, 3 },
+  { "race;", "∽\xCC\xB1", 5, 5 },
+  { "racute;", "ŕ", 7, 2 },
+  { "radic;", "√", 6, 3 },
+  { "raemptyv;", "⦳", 9, 3 },
+  { "rang;", "⟩", 5, 3 },
+  { "rangd;", "⦒", 6, 3 },
+  { "range;", "⦥", 6, 3 },
+  { "rangle;", "⟩", 7, 3 },
+  { "raquo", "»", 5, 2 },
+  { "raquo;", "»", 6, 2 },
+  { "rarr;", "→", 5, 3 },
+  { "rarrap;", "⥵", 7, 3 },
+  { "rarrb;", "⇥", 6, 3 },
+  { "rarrbfs;", "⤠", 8, 3 },
+  { "rarrc;", "⤳", 6, 3 },
+  { "rarrfs;", "⤞", 7, 3 },
+  { "rarrhk;", "↪", 7, 3 },
+  { "rarrlp;", "↬", 7, 3 },
+  { "rarrpl;", "⥅", 7, 3 },
+  { "rarrsim;", "⥴", 8, 3 },
+  { "rarrtl;", "↣", 7, 3 },
+  { "rarrw;", "↝", 6, 3 },
+  { "ratail;", "⤚", 7, 3 },
+  { "ratio;", "∶", 6, 3 },
+  { "rationals;", "ℚ", 10, 3 },
+  { "rbarr;", "⤍", 6, 3 },
+  { "rbbrk;", "❳", 6, 3 },
+  { "rbrace;", "}", 7, 1 },
+  { "rbrack;", "]", 7, 1 },
+  { "rbrke;", "⦌", 6, 3 },
+  { "rbrksld;", "⦎", 8, 3 },
+  { "rbrkslu;", "⦐", 8, 3 },
+  { "rcaron;", "ř", 7, 2 },
+  { "rcedil;", "ŗ", 7, 2 },
+  { "rceil;", "⌉", 6, 3 },
+  { "rcub;", "}", 5, 1 },
+  { "rcy;", "р", 4, 2 },
+  { "rdca;", "⤷", 5, 3 },
+  { "rdldhar;", "⥩", 8, 3 },
+  { "rdquo;", "”", 6, 3 },
+  { "rdquor;", "”", 7, 3 },
+  { "rdsh;", "↳", 5, 3 },
+  { "real;", "ℜ", 5, 3 },
+  { "realine;", "ℛ", 8, 3 },
+  { "realpart;", "ℜ", 9, 3 },
+  { "reals;", "ℝ", 6, 3 },
+  { "rect;", "▭", 5, 3 },
+  { "reg", "®", 3, 2 },
+  { "reg;", "®", 4, 2 },
+  { "rfisht;", "⥽", 7, 3 },
+  { "rfloor;", "⌋", 7, 3 },
+  { "rfr;", "𝔯", 4, 4 },
+  { "rhard;", "⇁", 6, 3 },
+  { "rharu;", "⇀", 6, 3 },
+  { "rharul;", "⥬", 7, 3 },
+  { "rho;", "ρ", 4, 2 },
+  { "rhov;", "ϱ", 5, 2 },
+  { "rightarrow;", "→", 11, 3 },
+  { "rightarrowtail;", "↣", 15, 3 },
+  { "rightharpoondown;", "⇁", 17, 3 },
+  { "rightharpoonup;", "⇀", 15, 3 },
+  { "rightleftarrows;", "⇄", 16, 3 },
+  { "rightleftharpoons;", "⇌", 18, 3 },
+  { "rightrightarrows;", "⇉", 17, 3 },
+  { "rightsquigarrow;", "↝", 16, 3 },
+  { "rightthreetimes;", "⋌", 16, 3 },
+  { "ring;", "˚", 5, 2 },
+  { "risingdotseq;", "≓", 13, 3 },
+  { "rlarr;", "⇄", 6, 3 },
+  { "rlhar;", "⇌", 6, 3 },
+  { "rlm;", "\xE2\x80\x8F", 4, 3 },
+  { "rmoust;", "⎱", 7, 3 },
+  { "rmoustache;", "⎱", 11, 3 },
+  { "rnmid;", "⫮", 6, 3 },
+  { "roang;", "⟭", 6, 3 },
+  { "roarr;", "⇾", 6, 3 },
+  { "robrk;", "⟧", 6, 3 },
+  { "ropar;", "⦆", 6, 3 },
+  { "ropf;", "𝕣", 5, 4 },
+  { "roplus;", "⨮", 7, 3 },
+  { "rotimes;", "⨵", 8, 3 },
+  { "rpar;", ")", 5, 1 },
+  { "rpargt;", "⦔", 7, 3 },
+  { "rppolint;", "⨒", 9, 3 },
+  { "rrarr;", "⇉", 6, 3 },
+  { "rsaquo;", "›", 7, 3 },
+  { "rscr;", "𝓇", 5, 4 },
+  { "rsh;", "↱", 4, 3 },
+  { "rsqb;", "]", 5, 1 },
+  { "rsquo;", "’", 6, 3 },
+  { "rsquor;", "’", 7, 3 },
+  { "rthree;", "⋌", 7, 3 },
+  { "rtimes;", "⋊", 7, 3 },
+  { "rtri;", "▹", 5, 3 },
+  { "rtrie;", "⊵", 6, 3 },
+  { "rtrif;", "▸", 6, 3 },
+  { "rtriltri;", "⧎", 9, 3 },
+  { "ruluhar;", "⥨", 8, 3 },
+  { "rx;", "℞", 3, 3 },
+  { "sacute;", "ś", 7, 2 },
+  { "sbquo;", "‚", 6, 3 },
+  { "sc;", "≻", 3, 3 },
+  { "scE;", "⪴", 4, 3 },
+  { "scap;", "⪸", 5, 3 },
+  { "scaron;", "š", 7, 2 },
+  { "sccue;", "≽", 6, 3 },
+  { "sce;", "⪰", 4, 3 },
+  { "scedil;", "ş", 7, 2 },
+  { "scirc;", "ŝ", 6, 2 },
+  { "scnE;", "⪶", 5, 3 },
+  { "scnap;", "⪺", 6, 3 },
+  { "scnsim;", "⋩", 7, 3 },
+  { "scpolint;", "⨓", 9, 3 },
+  { "scsim;", "≿", 6, 3 },
+  { "scy;", "с", 4, 2 },
+  { "sdot;", "⋅", 5, 3 },
+  { "sdotb;", "⊡", 6, 3 },
+  { "sdote;", "⩦", 6, 3 },
+  { "seArr;", "⇘", 6, 3 },
+  { "searhk;", "⤥", 7, 3 },
+  { "searr;", "↘", 6, 3 },
+  { "searrow;", "↘", 8, 3 },
+  { "sect", "§", 4, 2 },
+  { "sect;", "§", 5, 2 },
+  { "semi;", ";", 5, 1 },
+  { "seswar;", "⤩", 7, 3 },
+  { "setminus;", "∖", 9, 3 },
+  { "setmn;", "∖", 6, 3 },
+  { "sext;", "✶", 5, 3 },
+  { "sfr;", "𝔰", 4, 4 },
+  { "sfrown;", "⌢", 7, 3 },
+  { "sharp;", "♯", 6, 3 },
+  { "shchcy;", "щ", 7, 2 },
+  { "shcy;", "ш", 5, 2 },
+  { "shortmid;", "∣", 9, 3 },
+  { "shortparallel;", "∥", 14, 3 },
+  { "shy", "\xC2\xAD", 3, 2 },
+  { "shy;", "\xC2\xAD", 4, 2 },
+  { "sigma;", "σ", 6, 2 },
+  { "sigmaf;", "ς", 7, 2 },
+  { "sigmav;", "ς", 7, 2 },
+  { "sim;", "∼", 4, 3 },
+  { "simdot;", "⩪", 7, 3 },
+  { "sime;", "≃", 5, 3 },
+  { "simeq;", "≃", 6, 3 },
+  { "simg;", "⪞", 5, 3 },
+  { "simgE;", "⪠", 6, 3 },
+  { "siml;", "⪝", 5, 3 },
+  { "simlE;", "⪟", 6, 3 },
+  { "simne;", "≆", 6, 3 },
+  { "simplus;", "⨤", 8, 3 },
+  { "simrarr;", "⥲", 8, 3 },
+  { "slarr;", "←", 6, 3 },
+  { "smallsetminus;", "∖", 14, 3 },
+  { "smashp;", "⨳", 7, 3 },
+  { "smeparsl;", "⧤", 9, 3 },
+  { "smid;", "∣", 5, 3 },
+  { "smile;", "⌣", 6, 3 },
+  { "smt;", "⪪", 4, 3 },
+  { "smte;", "⪬", 5, 3 },
+  { "smtes;", "⪬\xEF\xB8\x80", 6, 6 },
+  { "softcy;", "ь", 7, 2 },
+  { "sol;", "/", 4, 1 },
+  { "solb;", "⧄", 5, 3 },
+  { "solbar;", "⌿", 7, 3 },
+  { "sopf;", "𝕤", 5, 4 },
+  { "spades;", "♠", 7, 3 },
+  { "spadesuit;", "♠", 10, 3 },
+  { "spar;", "∥", 5, 3 },
+  { "sqcap;", "⊓", 6, 3 },
+  { "sqcaps;", "⊓\xEF\xB8\x80", 7, 6 },
+  { "sqcup;", "⊔", 6, 3 },
+  { "sqcups;", "⊔\xEF\xB8\x80", 7, 6 },
+  { "sqsub;", "⊏", 6, 3 },
+  { "sqsube;", "⊑", 7, 3 },
+  { "sqsubset;", "⊏", 9, 3 },
+  { "sqsubseteq;", "⊑", 11, 3 },
+  { "sqsup;", "⊐", 6, 3 },
+  { "sqsupe;", "⊒", 7, 3 },
+  { "sqsupset;", "⊐", 9, 3 },
+  { "sqsupseteq;", "⊒", 11, 3 },
+  { "squ;", "□", 4, 3 },
+  { "square;", "□", 7, 3 },
+  { "squarf;", "▪", 7, 3 },
+  { "squf;", "▪", 5, 3 },
+  { "srarr;", "→", 6, 3 },
+  { "sscr;", "𝓈", 5, 4 },
+  { "ssetmn;", "∖", 7, 3 },
+  { "ssmile;", "⌣", 7, 3 },
+  { "sstarf;", "⋆", 7, 3 },
+  { "star;", "☆", 5, 3 },
+  { "starf;", "★", 6, 3 },
+  { "straightepsilon;", "ϵ", 16, 2 },
+  { "straightphi;", "ϕ", 12, 2 },
+  { "strns;", "¯", 6, 2 },
+  { "sub;", "⊂", 4, 3 },
+  { "subE;", "⫅", 5, 3 },
+  { "subdot;", "⪽", 7, 3 },
+  { "sube;", "⊆", 5, 3 },
+  { "subedot;", "⫃", 8, 3 },
+  { "submult;", "⫁", 8, 3 },
+  { "subnE;", "⫋", 6, 3 },
+  { "subne;", "⊊", 6, 3 },
+  { "subplus;", "⪿", 8, 3 },
+  { "subrarr;", "⥹", 8, 3 },
+  { "subset;", "⊂", 7, 3 },
+  { "subseteq;", "⊆", 9, 3 },
+  { "subseteqq;", "⫅", 10, 3 },
+  { "subsetneq;", "⊊", 10, 3 },
+  { "subsetneqq;", "⫋", 11, 3 },
+  { "subsim;", "⫇", 7, 3 },
+  { "subsub;", "⫕", 7, 3 },
+  { "subsup;", "⫓", 7, 3 },
+  { "succ;", "≻", 5, 3 },
+  { "succapprox;", "⪸", 11, 3 },
+  { "succcurlyeq;", "≽", 12, 3 },
+  { "succeq;", "⪰", 7, 3 },
+  { "succnapprox;", "⪺", 12, 3 },
+  { "succneqq;", "⪶", 9, 3 },
+  { "succnsim;", "⋩", 9, 3 },
+  { "succsim;", "≿", 8, 3 },
+  { "sum;", "∑", 4, 3 },
+  { "sung;", "♪", 5, 3 },
+  { "sup1", "¹", 4, 2 },
+  { "sup1;", "¹", 5, 2 },
+  { "sup2", "²", 4, 2 },
+  { "sup2;", "²", 5, 2 },
+  { "sup3", "³", 4, 2 },
+  { "sup3;", "³", 5, 2 },
+  { "sup;", "⊃", 4, 3 },
+  { "supE;", "⫆", 5, 3 },
+  { "supdot;", "⪾", 7, 3 },
+  { "supdsub;", "⫘", 8, 3 },
+  { "supe;", "⊇", 5, 3 },
+  { "supedot;", "⫄", 8, 3 },
+  { "suphsol;", "⟉", 8, 3 },
+  { "suphsub;", "⫗", 8, 3 },
+  { "suplarr;", "⥻", 8, 3 },
+  { "supmult;", "⫂", 8, 3 },
+  { "supnE;", "⫌", 6, 3 },
+  { "supne;", "⊋", 6, 3 },
+  { "supplus;", "⫀", 8, 3 },
+  { "supset;", "⊃", 7, 3 },
+  { "supseteq;", "⊇", 9, 3 },
+  { "supseteqq;", "⫆", 10, 3 },
+  { "supsetneq;", "⊋", 10, 3 },
+  { "supsetneqq;", "⫌", 11, 3 },
+  { "supsim;", "⫈", 7, 3 },
+  { "supsub;", "⫔", 7, 3 },
+  { "supsup;", "⫖", 7, 3 },
+  { "swArr;", "⇙", 6, 3 },
+  { "swarhk;", "⤦", 7, 3 },
+  { "swarr;", "↙", 6, 3 },
+  { "swarrow;", "↙", 8, 3 },
+  { "swnwar;", "⤪", 7, 3 },
+  { "szlig", "ß", 5, 2 },
+  { "szlig;", "ß", 6, 2 },
+  { "target;", "⌖", 7, 3 },
+  { "tau;", "τ", 4, 2 },
+  { "tbrk;", "⎴", 5, 3 },
+  { "tcaron;", "ť", 7, 2 },
+  { "tcedil;", "ţ", 7, 2 },
+  { "tcy;", "т", 4, 2 },
+  { "tdot;", "\xE2\x83\x9B", 5, 3 },
+  { "telrec;", "⌕", 7, 3 },
+  { "tfr;", "𝔱", 4, 4 },
+  { "there4;", "∴", 7, 3 },
+  { "therefore;", "∴", 10, 3 },
+  { "theta;", "θ", 6, 2 },
+  { "thetasym;", "ϑ", 9, 2 },
+  { "thetav;", "ϑ", 7, 2 },
+  { "thickapprox;", "≈", 12, 3 },
+  { "thicksim;", "∼", 9, 3 },
+  { "thinsp;", "\xE2\x80\x89", 7, 3 },
+  { "thkap;", "≈", 6, 3 },
+  { "thksim;", "∼", 7, 3 },
+  { "thorn", "þ", 5, 2 },
+  { "thorn;", "þ", 6, 2 },
+  { "tilde;", "˜", 6, 2 },
+  { "times", "×", 5, 2 },
+  { "times;", "×", 6, 2 },
+  { "timesb;", "⊠", 7, 3 },
+  { "timesbar;", "⨱", 9, 3 },
+  { "timesd;", "⨰", 7, 3 },
+  { "tint;", "∭", 5, 3 },
+  { "toea;", "⤨", 5, 3 },
+  { "top;", "⊤", 4, 3 },
+  { "topbot;", "⌶", 7, 3 },
+  { "topcir;", "⫱", 7, 3 },
+  { "topf;", "𝕥", 5, 4 },
+  { "topfork;", "⫚", 8, 3 },
+  { "tosa;", "⤩", 5, 3 },
+  { "tprime;", "‴", 7, 3 },
+  { "trade;", "™", 6, 3 },
+  { "triangle;", "▵", 9, 3 },
+  { "triangledown;", "▿", 13, 3 },
+  { "triangleleft;", "◃", 13, 3 },
+  { "trianglelefteq;", "⊴", 15, 3 },
+  { "triangleq;", "≜", 10, 3 },
+  { "triangleright;", "▹", 14, 3 },
+  { "trianglerighteq;", "⊵", 16, 3 },
+  { "tridot;", "◬", 7, 3 },
+  { "trie;", "≜", 5, 3 },
+  { "triminus;", "⨺", 9, 3 },
+  { "triplus;", "⨹", 8, 3 },
+  { "trisb;", "⧍", 6, 3 },
+  { "tritime;", "⨻", 8, 3 },
+  { "trpezium;", "⏢", 9, 3 },
+  { "tscr;", "𝓉", 5, 4 },
+  { "tscy;", "ц", 5, 2 },
+  { "tshcy;", "ћ", 6, 2 },
+  { "tstrok;", "ŧ", 7, 2 },
+  { "twixt;", "≬", 6, 3 },
+  { "twoheadleftarrow;", "↞", 17, 3 },
+  { "twoheadrightarrow;", "↠", 18, 3 },
+  { "uArr;", "⇑", 5, 3 },
+  { "uHar;", "⥣", 5, 3 },
+  { "uacute", "ú", 6, 2 },
+  { "uacute;", "ú", 7, 2 },
+  { "uarr;", "↑", 5, 3 },
+  { "ubrcy;", "ў", 6, 2 },
+  { "ubreve;", "ŭ", 7, 2 },
+  { "ucirc", "û", 5, 2 },
+  { "ucirc;", "û", 6, 2 },
+  { "ucy;", "у", 4, 2 },
+  { "udarr;", "⇅", 6, 3 },
+  { "udblac;", "ű", 7, 2 },
+  { "udhar;", "⥮", 6, 3 },
+  { "ufisht;", "⥾", 7, 3 },
+  { "ufr;", "𝔲", 4, 4 },
+  { "ugrave", "ù", 6, 2 },
+  { "ugrave;", "ù", 7, 2 },
+  { "uharl;", "↿", 6, 3 },
+  { "uharr;", "↾", 6, 3 },
+  { "uhblk;", "▀", 6, 3 },
+  { "ulcorn;", "⌜", 7, 3 },
+  { "ulcorner;", "⌜", 9, 3 },
+  { "ulcrop;", "⌏", 7, 3 },
+  { "ultri;", "◸", 6, 3 },
+  { "umacr;", "ū", 6, 2 },
+  { "uml", "¨", 3, 2 },
+  { "uml;", "¨", 4, 2 },
+  { "uogon;", "ų", 6, 2 },
+  { "uopf;", "𝕦", 5, 4 },
+  { "uparrow;", "↑", 8, 3 },
+  { "updownarrow;", "↕", 12, 3 },
+  { "upharpoonleft;", "↿", 14, 3 },
+  { "upharpoonright;", "↾", 15, 3 },
+  { "uplus;", "⊎", 6, 3 },
+  { "upsi;", "υ", 5, 2 },
+  { "upsih;", "ϒ", 6, 2 },
+  { "upsilon;", "υ", 8, 2 },
+  { "upuparrows;", "⇈", 11, 3 },
+  { "urcorn;", "⌝", 7, 3 },
+  { "urcorner;", "⌝", 9, 3 },
+  { "urcrop;", "⌎", 7, 3 },
+  { "uring;", "ů", 6, 2 },
+  { "urtri;", "◹", 6, 3 },
+  { "uscr;", "𝓊", 5, 4 },
+  { "utdot;", "⋰", 6, 3 },
+  { "utilde;", "ũ", 7, 2 },
+  { "utri;", "▵", 5, 3 },
+  { "utrif;", "▴", 6, 3 },
+  { "uuarr;", "⇈", 6, 3 },
+  { "uuml", "ü", 4, 2 },
+  { "uuml;", "ü", 5, 2 },
+  { "uwangle;", "⦧", 8, 3 },
+  { "vArr;", "⇕", 5, 3 },
+  { "vBar;", "⫨", 5, 3 },
+  { "vBarv;", "⫩", 6, 3 },
+  { "vDash;", "⊨", 6, 3 },
+  { "vangrt;", "⦜", 7, 3 },
+  { "varepsilon;", "ϵ", 11, 2 },
+  { "varkappa;", "ϰ", 9, 2 },
+  { "varnothing;", "∅", 11, 3 },
+  { "varphi;", "ϕ", 7, 2 },
+  { "varpi;", "ϖ", 6, 2 },
+  { "varpropto;", "∝", 10, 3 },
+  { "varr;", "↕", 5, 3 },
+  { "varrho;", "ϱ", 7, 2 },
+  { "varsigma;", "ς", 9, 2 },
+  { "varsubsetneq;", "⊊\xEF\xB8\x80", 13, 6 },
+  { "varsubsetneqq;", "⫋\xEF\xB8\x80", 14, 6 },
+  { "varsupsetneq;", "⊋\xEF\xB8\x80", 13, 6 },
+  { "varsupsetneqq;", "⫌\xEF\xB8\x80", 14, 6 },
+  { "vartheta;", "ϑ", 9, 2 },
+  { "vartriangleleft;", "⊲", 16, 3 },
+  { "vartriangleright;", "⊳", 17, 3 },
+  { "vcy;", "в", 4, 2 },
+  { "vdash;", "⊢", 6, 3 },
+  { "vee;", "∨", 4, 3 },
+  { "veebar;", "⊻", 7, 3 },
+  { "veeeq;", "≚", 6, 3 },
+  { "vellip;", "⋮", 7, 3 },
+  { "verbar;", "|", 7, 1 },
+  { "vert;", "|", 5, 1 },
+  { "vfr;", "𝔳", 4, 4 },
+  { "vltri;", "⊲", 6, 3 },
+  { "vnsub;", "⊂\xE2\x83\x92", 6, 6 },
+  { "vnsup;", "⊃\xE2\x83\x92", 6, 6 },
+  { "vopf;", "𝕧", 5, 4 },
+  { "vprop;", "∝", 6, 3 },
+  { "vrtri;", "⊳", 6, 3 },
+  { "vscr;", "𝓋", 5, 4 },
+  { "vsubnE;", "⫋\xEF\xB8\x80", 7, 6 },
+  { "vsubne;", "⊊\xEF\xB8\x80", 7, 6 },
+  { "vsupnE;", "⫌\xEF\xB8\x80", 7, 6 },
+  { "vsupne;", "⊋\xEF\xB8\x80", 7, 6 },
+  { "vzigzag;", "⦚", 8, 3 },
+  { "wcirc;", "ŵ", 6, 2 },
+  { "wedbar;", "⩟", 7, 3 },
+  { "wedge;", "∧", 6, 3 },
+  { "wedgeq;", "≙", 7, 3 },
+  { "weierp;", "℘", 7, 3 },
+  { "wfr;", "𝔴", 4, 4 },
+  { "wopf;", "𝕨", 5, 4 },
+  { "wp;", "℘", 3, 3 },
+  { "wr;", "≀", 3, 3 },
+  { "wreath;", "≀", 7, 3 },
+  { "wscr;", "𝓌", 5, 4 },
+  { "xcap;", "⋂", 5, 3 },
+  { "xcirc;", "◯", 6, 3 },
+  { "xcup;", "⋃", 5, 3 },
+  { "xdtri;", "▽", 6, 3 },
+  { "xfr;", "𝔵", 4, 4 },
+  { "xhArr;", "⟺", 6, 3 },
+  { "xharr;", "⟷", 6, 3 },
+  { "xi;", "ξ", 3, 2 },
+  { "xlArr;", "⟸", 6, 3 },
+  { "xlarr;", "⟵", 6, 3 },
+  { "xmap;", "⟼", 5, 3 },
+  { "xnis;", "⋻", 5, 3 },
+  { "xodot;", "⨀", 6, 3 },
+  { "xopf;", "𝕩", 5, 4 },
+  { "xoplus;", "⨁", 7, 3 },
+  { "xotime;", "⨂", 7, 3 },
+  { "xrArr;", "⟹", 6, 3 },
+  { "xrarr;", "⟶", 6, 3 },
+  { "xscr;", "𝓍", 5, 4 },
+  { "xsqcup;", "⨆", 7, 3 },
+  { "xuplus;", "⨄", 7, 3 },
+  { "xutri;", "△", 6, 3 },
+  { "xvee;", "⋁", 5, 3 },
+  { "xwedge;", "⋀", 7, 3 },
+  { "yacute", "ý", 6, 2 },
+  { "yacute;", "ý", 7, 2 },
+  { "yacy;", "я", 5, 2 },
+  { "ycirc;", "ŷ", 6, 2 },
+  { "ycy;", "ы", 4, 2 },
+  { "yen", "¥", 3, 2 },
+  { "yen;", "¥", 4, 2 },
+  { "yfr;", "𝔶", 4, 4 },
+  { "yicy;", "ї", 5, 2 },
+  { "yopf;", "𝕪", 5, 4 },
+  { "yscr;", "𝓎", 5, 4 },
+  { "yucy;", "ю", 5, 2 },
+  { "yuml", "ÿ", 4, 2 },
+  { "yuml;", "ÿ", 5, 2 },
+  { "zacute;", "ź", 7, 2 },
+  { "zcaron;", "ž", 7, 2 },
+  { "zcy;", "з", 4, 2 },
+  { "zdot;", "ż", 5, 2 },
+  { "zeetrf;", "ℨ", 7, 3 },
+  { "zeta;", "ζ", 5, 2 },
+  { "zfr;", "𝔷", 4, 4 },
+  { "zhcy;", "ж", 5, 2 },
+  { "zigrarr;", "⇝", 8, 3 },
+  { "zopf;", "𝕫", 5, 4 },
+  { "zscr;", "𝓏", 5, 4 },
+  { "zwj;", "\xE2\x80\x8D", 4, 3 },
+  { "zwnj;", "\xE2\x80\x8C", 5, 3 }
+};
+
+static const unsigned char kEntitySeeds[1024] = {
+  3, 5, 3, 2, 2, 1, 4, 2, 1, 1, 1, 4, 3, 2, 2, 0,
+  1, 1, 0, 5, 2, 1, 8, 0, 1, 2, 2, 0, 1, 3, 0, 1,
+  3, 2, 3, 3, 1, 7, 4, 2, 2, 1, 2, 1, 2, 2, 2, 0,
+  2, 4, 0, 1, 1, 2, 2, 2, 1, 3, 6, 1, 2, 0, 2, 0,
+  2, 2, 3, 1, 1, 0, 1, 4, 4, 1, 3, 2, 2, 3, 0, 3,
+  1, 1, 0, 1, 1, 1, 5, 2, 1, 1, 1, 1, 1, 0, 2, 1,
+  1, 1, 2, 1, 1, 1, 3, 1, 3, 1, 1, 7, 2, 3, 0, 4,
+  1, 1, 14, 6, 1, 7, 2, 17, 1, 1, 2, 1, 3, 1, 0, 1,
+  1, 8, 1, 1, 1, 2, 22, 1, 7, 1, 1, 1, 1, 0, 1, 2,
+  7, 0, 8, 1, 6, 1, 5, 0, 2, 1, 2, 1, 1, 2, 1, 2,
+  2, 2, 3, 0, 2, 2, 2, 1, 6, 1, 1, 1, 1, 1, 1, 1,
+  3, 8, 1, 0, 1, 1, 1, 7, 4, 1, 9, 1, 1, 0, 1, 2,
+  1, 1, 1, 1, 7, 4, 2, 6, 1, 3, 5, 1, 0, 1, 1, 1,
+  1, 2, 1, 8, 2, 1, 1, 2, 1, 1, 0, 5, 4, 1, 1, 1,
+  0, 2, 1, 2, 6, 1, 1, 1, 1, 1, 3, 1, 4, 1, 2, 1,
+  1, 1, 1, 2, 2, 3, 0, 4, 3, 1, 0, 2, 0, 43, 1, 2,
+  3, 2, 6, 1, 4, 1, 8, 1, 11, 14, 3, 5, 16, 0, 1, 1,
+  1, 2, 6, 2, 4, 2, 4, 1, 1, 4, 1, 4, 0, 0, 64, 2,
+  1, 3, 1, 1, 2, 1, 1, 3, 2, 1, 4, 1, 0, 5, 5, 1,
+  2, 2, 1, 1, 0, 1, 1, 0, 5, 1, 5, 2, 1, 3, 3, 3,
+  0, 1, 7, 9, 1, 3, 3, 0, 6, 1, 3, 2, 1, 0, 0, 3,
+  6, 1, 1, 1, 1, 17, 1, 7, 5, 2, 2, 1, 3, 2, 1, 2,
+  0, 5, 7, 3, 1, 2, 2, 0, 0, 1, 1, 1, 1, 1, 1, 3,
+  3, 1, 4, 1, 7, 3, 3, 1, 0, 1, 3, 5, 1, 2, 6, 4,
+  18, 2, 1, 2, 1, 4, 1, 2, 2, 1, 1, 1, 1, 4, 3, 1,
+  4, 5, 3, 1, 2, 1, 1, 1, 4, 3, 1, 3, 3, 6, 1, 16,
+  3, 4, 7, 1, 1, 3, 0, 9, 1, 3, 0, 9, 4, 0, 3, 10,
+  2, 1, 0, 3, 57, 6, 1, 1, 2, 0, 5, 20, 1, 2, 3, 2,
+  1, 1, 2, 3, 7, 1, 0, 1, 4, 1, 2, 5, 1, 1, 1, 0,
+  1, 1, 0, 1, 1, 5, 1, 1, 1, 4, 0, 2, 2, 2, 4, 0,
+  1, 1, 6, 2, 1, 0, 1, 4, 2, 1, 1, 0, 2, 1, 0, 64,
+  2, 1, 1, 1, 2, 2, 3, 1, 1, 14, 1, 1, 1, 1, 3, 2,
+  1, 2, 3, 1, 27, 1, 64, 5, 3, 1, 1, 1, 0, 7, 1, 1,
+  64, 1, 5, 4, 5, 1, 3, 4, 1, 1, 1, 3, 1, 2, 5, 0,
+  3, 2, 0, 1, 0, 1, 1, 2, 4, 5, 2, 2, 2, 2, 1, 9,
+  11, 1, 1, 0, 1, 0, 2, 4, 1, 2, 2, 1, 0, 4, 3, 1,
+  11, 3, 0, 1, 14, 5, 1, 0, 1, 2, 2, 0, 1, 2, 6, 0,
+  1, 2, 4, 0, 1, 20, 3, 65, 1, 5, 47, 1, 1, 3, 2, 1,
+  1, 1, 8, 16, 2, 1, 0, 6, 64, 50, 1, 64, 2, 0, 1, 9,
+  1, 2, 9, 1, 2, 4, 3, 5, 1, 1, 3, 0, 26, 2, 0, 4,
+  1, 1, 4, 0, 1, 0, 3, 1, 2, 1, 2, 5, 0, 0, 0, 1,
+  1, 4, 0, 1, 6, 3, 0, 5, 2, 2, 0, 17, 6, 0, 1, 2,
+  1, 10, 2, 1, 2, 2, 1, 1, 1, 1, 2, 0, 1, 17, 0, 1,
+  33, 1, 1, 6, 1, 5, 2, 0, 1, 1, 25, 3, 3, 2, 1, 1,
+  2, 0, 64, 1, 1, 21, 2, 1, 2, 1, 1, 3, 7, 3, 1, 4,
+  0, 2, 16, 7, 10, 3, 7, 2, 31, 64, 1, 1, 2, 2, 4, 0,
+  2, 5, 2, 2, 3, 2, 1, 3, 7, 4, 2, 4, 1, 1, 6, 0,
+  5, 4, 1, 4, 1, 3, 3, 29, 1, 6, 3, 2, 1, 9, 2, 2,
+  1, 0, 2, 10, 7, 5, 0, 1, 2, 5, 0, 3, 33, 10, 1, 4,
+  1, 3, 9, 1, 3, 0, 2, 1, 2, 3, 1, 4, 1, 3, 1, 6,
+  2, 47, 5, 4, 1, 5, 1, 2, 6, 2, 0, 3, 1, 3, 1, 1,
+  4, 1, 2, 1, 1, 5, 1, 4, 0, 12, 2, 3, 2, 8, 2, 73,
+  1, 4, 0, 1, 1, 3, 1, 2, 1, 9, 4, 2, 2, 1, 1, 67,
+  17, 0, 0, 3, 1, 3, 2, 3, 8, 2, 5, 9, 2, 4, 6, 5,
+  1, 0, 2, 6, 1, 2, 4, 2, 3, 6, 5, 0, 3, 1, 13, 0,
+  1, 3, 3, 1, 2, 1, 2, 4, 2, 3, 0, 6, 6, 2, 2, 1,
+  1, 3, 2, 2, 3, 2, 1, 2, 68, 1, 2, 2, 3, 1, 1, 9,
+  3, 2, 66, 1, 4, 10, 4, 1, 3, 1, 3, 1, 1, 1, 4, 0,
+  2, 64, 1, 5, 1, 1, 2, 1, 39, 30, 0, 9, 8, 2, 4, 1,
+  1, 34, 2, 1, 4, 2, 5, 3, 6, 2, 1, 2, 3, 3, 4, 6,
+  0, 0, 0, 1, 0, 2, 3, 1, 10, 3, 1, 1, 4, 0, 4, 0,
+  0, 1, 1, 19, 0, 2, 1, 1, 66, 2, 5, 4, 1, 12, 0, 2,
+  1, 4, 0, 0, 65, 3, 11, 11, 2, 25, 2, 5, 3, 4, 2, 3,
+  1, 8, 1, 1, 2, 3, 1, 2, 5, 2, 1, 1, 2, 2, 2, 3
+};
+
+static const short kEntitySlots[4096] = {
+  -1, 547, 1647, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  368, 1903, -1, 1069, -1, 2155, 1813, 2025, -1, 1648, 240, -1,
+  -1, 1422, 343, -1, 427, -1, -1, 1219, 1498, 1262, -1, -1,
+  1305, 1822, 1958, 360, 1849, 1434, 2184, -1, -1, -1, 1395, 159,
+  1983, -1, 2073, 2030, -1, -1, 851, 1741, 1245, -1, 160, 2107,
+  317, -1, -1, -1, 1316, -1, 1076, 719, -1, -1, 1380, -1,
+  1768, 927, 1304, 807, 1130, -1, 119, 2129, -1, -1, -1, 2059,
+  948, -1, 1029, -1, -1, 1946, -1, -1, -1, 1455, -1, -1,
+  -1, 1449, 385, 382, 397, -1, -1, -1, -1, -1, 1522, -1,
+  1599, -1, 932, 593, -1, -1, -1, 2147, 1339, -1, -1, -1,
+  -1, -1, -1, 2034, -1, 451, -1, 2185, 1708, 1407, -1, 2148,
+  -1, -1, 1414, 2229, -1, 1095, -1, -1, -1, 2167, -1, 1046,
+  -1, 1668, 974, 1268, -1, 1234, -1, 1042, 1017, -1, 2162, 1671,
+  -1, 486, -1, -1, 685, 1624, 1400, -1, 1132, 1185, -1, -1,
+  1236, 1049, 2022, 1181, 39, -1, 1831, -1, 314, -1, 1716, -1,
+  -1, -1, 1574, 269, -1, 1537, 1346, 1184, 1218, 419, -1, 1369,
+  266, -1, 1243, -1, 1852, 999, 409, 1779, -1, 340, 701, 1040,
+  -1, 2102, 434, -1, 1481, -1, 1784, -1, 817, 502, 798, 1377,
+  1436, -1, -1, -1, 1337, 820, -1, 1248, 274, -1, -1, 771,
+  557, -1, 2160, -1, 1810, -1, 170, -1, -1, 166, 445, -1,
+  -1, 277, 1255, 1007, -1, -1, 126, 76, -1, -1, 1639, 667,
+  467, -1, -1, 1166, -1, 643, 1163, 161, -1, 1220, 1013, -1,
+  -1, 67, -1, 877, 1593, -1, 108, -1, -1, 1439, 2014, -1,
+  2007, -1, -1, -1, 1900, -1, 345, 182, -1, -1, 843, -1,
+  1630, 2200, -1, 57, 1019, 2145, 180, 256, 1670, 1227, 500, 717,
+  -1, -1, -1, 794, -1, -1, 1325, -1, 1984, 2224, 338, 750,
+  1213, 1116, 2168, 830, 22, 1284, 1713, -1, 1428, -1, -1, -1,
+  579, 1214, 436, 389, -1, -1, 2105, 279, 977, 1409, 1780, 1360,
+  376, 31, -1, 905, -1, 2076, 242, -1, -1, -1, 89, -1,
+  1228, -1, -1, -1, 759, -1, 21, -1, 1039, -1, -1, 364,
+  1075, 1589, 2069, -1, 1608, -1, 1160, -1, -1, -1, 1961, -1,
+  -1, 832, -1, -1, 802, 1625, 886, 1702, -1, 1592, -1, -1,
+  2084, 1001, 1068, 1462, -1, 1310, -1, -1, 1553, 1161, -1, -1,
+  911, 1475, 2043, 562, -1, -1, -1, 1705, -1, -1, -1, 506,
+  -1, 904, -1, 470, -1, -1, 1485, 1419, 527, 681, -1, -1,
+  671, 1753, 574, -1, 477, 1131, -1, 1014, 822, 261, -1, 1329,
+  495, -1, -1, -1, -1, -1, 926, -1, 861, -1, 1175, 2040,
+  -1, 1104, -1, -1, -1, 592, -1, -1, -1, 1037, -1, -1,
+  876, -1, -1, -1, 49, -1, -1, 2062, 1344, 1121, 1884, 791,
+  458, 2142, 1402, -1, 1835, -1, -1, 1633, 1070, 1303, 1767, 191,
+  -1, -1, 462, -1, 2047, -1, -1, -1, -1, 1771, -1, 1591,
+  1149, -1, -1, 491, 319, -1, 1027, 1476, -1, 1894, 880, 2133,
+  1032, 288, -1, -1, -1, 216, -1, -1, 10, -1, 790, 1760,
+  -1, 415, -1, -1, 1980, -1, 586, 258, -1, 165, -1, 1653,
+  1457, -1, 656, 158, -1, 1581, 913, -1, -1, -1, 605, -1,
+  1583, -1, -1, 377, -1, 1805, -1, -1, 1973, 1382, -1, -1,
+  -1, -1, 268, -1, -1, 212, 1370, 1445, 1483, -1, 626, -1,
+  -1, 2055, 981, 1399, -1, 983, 1466, 1791, 1505, -1, -1, -1,
+  1558, 84, 1690, -1, 1084, 1067, -1, -1, 857, 1222, -1, -1,
+  -1, -1, 795, 944, 1774, -1, -1, 394, -1, -1, -1, 374,
+  1564, 179, 533, -1, 1993, -1, 2159, 811, -1, 1412, -1, -1,
+  1979, 400, 988, -1, 1502, 483, -1, 1052, 1100, -1, 109, -1,
+  796, 1144, -1, 142, -1, 1206, 754, -1, 398, -1, 1418, -1,
+  -1, -1, -1, -1, 1381, -1, 1321, 63, 1694, -1, -1, 659,
+  381, 162, -1, -1, -1, 634, -1, -1, 184, 990, 2219, -1,
+  -1, 1825, -1, -1, 1857, -1, -1, 972, -1, -1, 1534, -1,
+  1781, 1497, -1, 645, -1, 2066, 609, 1385, 1295, -1, 28, 1146,
+  1155, -1, 1147, 952, 992, -1, 1386, 1562, 1757, -1, 801, -1,
+  1565, 815, 942, 746, -1, 1928, -1, 1142, 286, 1195, 582, 737,
+  -1, -1, -1, -1, -1, 1392, 1259, 2101, 36, 589, -1, 2206,
+  494, -1, 1722, -1, -1, 1278, 492, -1, 907, 1931, 1578, 564,
+  -1, -1, 1110, -1, -1, 714, -1, -1, 447, 850, -1, 1490,
+  1482, 842, 1254, -1, -1, 641, 1286, 1966, 1571, -1, -1, 570,
+  1352, -1, -1, 571, -1, 2061, -1, 1034, -1, 890, 1443, -1,
+  -1, -1, -1, 1844, 1836, 193, -1, -1, -1, -1, 736, 101,
+  864, 501, 757, 1047, 558, 1055, 976, -1, -1, -1, 1759, 614,
+  -1, 307, -1, 1610, 464, 55, 632, 1487, -1, 437, -1, -1,
+  -1, 1277, -1, -1, 1586, -1, 151, -1, -1, 707, 2078, 225,
+  1730, -1, 651, -1, 555, 588, 831, 1637, 257, -1, 1927, -1,
+  -1, -1, 98, 1516, 780, -1, 1739, 1355, 2143, 1135, 943, 228,
+  235, 1555, -1, -1, 1367, -1, 1666, 1491, -1, -1, -1, 841,
+  -1, 181, 1178, 1397, -1, -1, -1, 553, -1, 1925, 804, 1340,
+  -1, 1182, 1626, 124, 1210, 2052, 1328, -1, -1, 1704, -1, 153,
+  601, 2075, 749, 909, 420, -1, 1703, 1826, -1, -1, 378, 650,
+  -1, 214, 1898, -1, -1, 1107, 1264, 1430, 2070, 2118, 369, -1,
+  1542, -1, -1, 1789, 1919, 887, 346, -1, 666, -1, 134, -1,
+  1280, 1224, -1, 718, 1300, -1, -1, 1943, 135, 1114, -1, 1851,
+  -1, -1, -1, 1615, 1939, 150, 1944, 1956, -1, -1, 1136, -1,
+  -1, 1293, -1, -1, 1102, -1, 2056, 2017, -1, 1124, -1, -1,
+  -1, -1, 1096, -1, -1, -1, -1, 1506, -1, 1808, 2164, -1,
+  705, 73, -1, 302, -1, -1, -1, 2089, 1815, 1425, -1, -1,
+  -1, 872, -1, 473, -1, 493, -1, 1656, -1, 929, -1, -1,
+  631, 1604, 1099, -1, -1, 357, 1847, 348, -1, -1, 1929, 2124,
+  -1, 1790, 2204, -1, -1, 2199, 1523, 2104, 700, 1642, -1, -1,
+  -1, -1, 1197, 272, -1, -1, -1, 44, -1, -1, -1, 1911,
+  -1, -1, -1, 1761, -1, -1, 985, 678, 183, 813, 1834, -1,
+  -1, -1, 1726, -1, -1, -1, 1082, -1, -1, 1661, -1, 1350,
+  636, 1559, 294, -1, -1, -1, 1698, 1531, 1893, 1018, 778, -1,
+  -1, -1, 1865, -1, -1, 1250, 743, 1232, 2172, -1, 541, 956,
+  -1, 1168, -1, -1, -1, 824, 618, -1, 1221, 1398, 264, -1,
+  -1, -1, 1715, 1746, 1469, -1, 1904, 1348, 140, -1, 1620, -1,
+  -1, -1, 1539, -1, -1, 255, -1, -1, 2020, -1, -1, -1,
+  739, 1194, -1, 2013, 361, -1, -1, 311, -1, 529, 1692, 262,
+  1202, -1, -1, -1, -1, 2054, -1, -1, 623, 1045, 1985, 693,
+  -1, -1, 2186, -1, 1225, 363, 2044, -1, 2223, -1, 1447, 1478,
+  355, 431, -1, 1006, 1785, -1, 587, 232, 619, 1595, 352, 1470,
+  -1, -1, 635, -1, 1260, 5, -1, 479, -1, -1, -1, 1550,
+  1689, 1861, 1035, -1, 2009, -1, 1856, -1, -1, -1, 241, 1179,
+  -1, 379, 2218, 674, 1594, 1905, 1326, -1, -1, -1, -1, -1,
+  484, 1294, 291, -1, -1, 487, 906, -1, -1, 1282, -1, 120,
+  -1, -1, 265, 1256, -1, 1235, -1, 1842, -1, 2195, -1, 1170,
+  226, -1, -1, -1, 519, 2002, -1, -1, 2174, 2094, -1, -1,
+  -1, 2028, -1, -1, -1, -1, -1, 565, 1570, -1, 1078, -1,
+  1374, 514, -1, 1876, 1938, 901, 278, 1334, 1330, 949, -1, 2226,
+  1658, 2077, -1, -1, -1, -1, -1, 617, 590, 934, -1, 2141,
+  -1, 1429, 1646, 1858, -1, -1, 1500, -1, 936, -1, -1, 524,
+  507, -1, 1123, 1600, -1, 417, -1, 1118, 1517, -1, -1, 1484,
+  211, 499, -1, -1, -1, 1769, 459, -1, 1129, -1, 534, 1247,
+  -1, -1, -1, 1910, 82, 2119, 1855, -1, 584, 689, 1862, 1331,
+  -1, -1, 1448, 1021, 2050, -1, 146, -1, 131, 1285, 365, 2156,
+  -1, -1, -1, -1, -1, -1, 786, 1320, 664, 1103, -1, 1229,
+  -1, 1108, 2197, 2146, 1159, 2209, -1, -1, -1, -1, -1, 395,
+  -1, 1394, -1, 1251, -1, -1, 1501, -1, -1, -1, 1823, -1,
+  358, 542, -1, 1868, -1, -1, 1889, -1, -1, -1, 2176, 1183,
+  -1, -1, 1778, -1, 550, -1, -1, 1651, 1137, -1, 1606, -1,
+  249, -1, -1, 24, 1711, 222, 752, 1580, -1, 147, -1, -1,
+  -1, -1, 2, 581, 1794, -1, 1291, 1623, -1, -1, 1731, 2215,
+  668, 2201, 2132, -1, -1, 825, -1, 56, -1, 1315, -1, 611,
+  2178, 64, -1, 566, 745, -1, -1, -1, -1, 9, 396, -1,
+  -1, 837, -1, -1, 324, 835, 227, 2087, 2006, -1, -1, -1,
+  -1, 1311, 1026, -1, 1515, 2081, 624, -1, 1846, -1, -1, 1098,
+  -1, 1776, -1, -1, 1151, -1, -1, 867, 75, 283, -1, -1,
+  1991, 1729, -1, -1, 939, -1, 1489, 954, -1, -1, 1618, 1875,
+  -1, 168, -1, 1833, -1, 354, -1, -1, -1, 2180, -1, 1879,
+  -1, -1, -1, 1143, -1, 164, -1, 594, 333, 13, 747, 878,
+  1156, -1, -1, 512, -1, -1, 1990, -1, 412, -1, -1, 1435,
+  -1, -1, 1588, 1549, -1, 1105, -1, 88, 511, -1, 1782, 1897,
+  1964, -1, -1, 1556, 215, 1987, 334, 224, -1, -1, -1, -1,
+  -1, 112, -1, -1, -1, 1830, -1, 625, 254, -1, 127, -1,
+  -1, -1, 1770, 1471, 2214, -1, 950, -1, 1602, 2192, -1, 1765,
+  -1, 1003, 1896, -1, -1, 2037, -1, -1, -1, -1, 375, 627,
+  869, 342, -1, -1, 1193, -1, 551, 1792, -1, -1, -1, -1,
+  -1, 639, -1, -1, 390, -1, -1, -1, 915, 2193, -1, 201,
+  -1, 1008, 1266, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 497, -1, -1, -1, -1, 2163, -1, -1, -1, 1828, -1,
+  1263, -1, -1, 187, -1, 1417, 1364, 2114, 418, -1, 725, -1,
+  243, 2036, -1, 675, 2144, -1, -1, 1438, -1, 2216, 70, 508,
+  741, -1, 1111, -1, 362, 646, -1, -1, 1022, 1358, -1, -1,
+  156, 1406, -1, 1079, 2169, 2202, -1, 2058, 2171, 373, 2113, -1,
+  1423, -1, -1, -1, 1880, 1241, -1, 657, -1, 1208, 762, 218,
+  -1, -1, 1174, 1934, 287, 853, 370, 1413, 819, 1660, 1362, -1,
+  1728, -1, 504, -1, 1486, 856, 1361, -1, -1, 763, -1, -1,
+  1240, 1384, 917, 2136, 210, 4, 1094, -1, -1, 325, 1317, 710,
+  556, 301, -1, 1444, -1, 77, -1, 930, 273, -1, 1799, 1000,
+  1080, 3, 1239, -1, 572, 805, 653, 1614, 426, -1, -1, 133,
+  -1, 356, -1, 1393, 923, -1, 1480, 1638, 2063, -1, -1, -1,
+  1907, 1773, -1, 478, 1192, 1404, 713, -1, 695, 47, -1, 598,
+  -1, 433, 1804, -1, -1, -1, -1, 1735, 12, -1, 68, 1176,
+  1687, 1165, 1521, 2190, 1887, 2221, 2183, 139, 72, -1, -1, -1,
+  -1, -1, -1, -1, -1, -1, 1673, 1432, -1, 1134, -1, -1,
+  -1, 1297, 125, 251, -1, -1, -1, 322, -1, -1, 879, 847,
+  221, -1, 1089, -1, 383, -1, -1, 1954, 935, -1, 961, 1533,
+  573, -1, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1,
+  -1, 2121, -1, 138, 20, -1, 305, 78, -1, 1527, 1821, 1684,
+  -1, 250, 1319, 1056, 1171, 655, 1932, 448, 489, 299, 1004, 476,
+  -1, 320, 1085, 1452, 509, 1937, 336, 446, -1, -1, 2071, 2161,
+  -1, 1920, -1, -1, -1, 724, -1, 172, -1, -1, 973, 2035,
+  -1, 1561, -1, -1, 410, 788, -1, 79, -1, -1, -1, 281,
+  -1, -1, -1, 637, -1, 1119, 1002, 1020, -1, 984, -1, 2112,
+  -1, -1, -1, 1590, -1, 720, -1, -1, -1, 844, 897, 1244,
+  -1, 2041, 1322, 1275, -1, 143, 1058, 1127, -1, 938, -1, 1391,
+  -1, -1, -1, -1, -1, -1, 391, 1820, 2086, 1738, 1895, 2098,
+  -1, -1, 1936, 729, -1, -1, 1677, -1, 449, 99, -1, 532,
+  640, -1, 808, 1901, 95, -1, 1366, -1, -1, 888, -1, 414,
+  1062, 1744, -1, 1292, 1962, -1, -1, -1, 2211, -1, -1, -1,
+  1071, -1, -1, -1, 969, -1, 1373, -1, 1546, 245, -1, -1,
+  2138, -1, 546, -1, -1, -1, 1249, 1203, -1, 708, 457, -1,
+  -1, -1, -1, 970, -1, 1051, 758, -1, 1650, -1, 1959, -1,
+  -1, -1, -1, -1, 957, -1, 392, -1, -1, -1, 733, -1,
+  -1, -1, -1, 1451, -1, -1, 940, 2120, -1, -1, -1, 1324,
+  -1, -1, -1, 38, -1, -1, 2227, 25, -1, 1838, -1, -1,
+  1982, 1796, 402, -1, -1, 881, 155, 200, -1, 163, 716, -1,
+  1010, -1, -1, 1493, -1, 1525, 1513, -1, -1, 1162, 826, 1081,
+  2153, 1446, 328, 1933, 1115, 836, 102, -1, -1, 1960, -1, 252,
+  2177, 1281, 1005, -1, -1, 1464, -1, -1, 1640, 520, 267, -1,
+  -1, 776, 1665, 962, 1120, -1, -1, 2210, -1, -1, 54, 1524,
+  -1, 1699, 898, -1, 145, 1742, -1, 1723, 1109, 1544, 1802, -1,
+  -1, -1, -1, 613, 2228, 986, 1719, -1, -1, 1628, -1, -1,
+  -1, 595, 1349, 2018, -1, -1, 951, -1, -1, 27, -1, -1,
+  697, 1036, 684, 1261, 1942, 1680, 1307, -1, 372, -1, -1, 1998,
+  1587, 371, -1, 621, -1, 1763, 2208, -1, 1866, -1, 855, 1576,
+  411, -1, 548, -1, -1, -1, -1, 1756, -1, 1864, 994, 2091,
+  2095, -1, -1, -1, 69, 1616, 1327, -1, -1, -1, 1859, -1,
+  2179, 510, 777, 538, 1632, -1, -1, 401, -1, -1, -1, 304,
+  730, -1, 229, -1, 528, 1848, -1, -1, -1, -1, 1454, 321,
+  206, -1, -1, 568, -1, 1437, -1, -1, 1059, 17, 1314, -1,
+  -1, -1, -1, -1, -1, -1, 2039, -1, 1072, 1976, -1, 1798,
+  -1, 1298, -1, -1, 186, -1, 1676, 518, -1, -1, 959, -1,
+  1538, 1226, -1, -1, 1540, 845, -1, -1, -1, -1, -1, -1,
+  -1, 1551, -1, -1, 2051, 535, 1970, 144, 474, 2093, -1, 1814,
+  688, 895, -1, -1, -1, 1786, -1, 404, 2021, 597, -1, 1674,
+  -1, -1, -1, -1, -1, -1, 1306, -1, 253, -1, 482, -1,
+  441, -1, -1, 648, 1557, 1356, 1507, 1941, 461, -1, 799, 1584,
+  -1, 1190, 238, 522, -1, -1, 2106, -1, 860, -1, 2065, -1,
+  544, -1, 65, -1, 1816, -1, -1, 1659, -1, 315, 966, 1548,
+  -1, 616, 430, 1737, 231, 554, -1, 1313, 731, -1, 48, 596,
+  1989, 2182, 852, 1972, 2023, 1597, -1, -1, 2048, -1, -1, 1290,
+  1048, -1, 2001, 220, -1, -1, 1749, 1511, 2096, 2032, -1, 1461,
+  2181, 171, -1, 58, 335, -1, -1, 630, -1, -1, -1, -1,
+  1421, -1, -1, 1172, 1795, -1, -1, -1, 908, -1, 1530, 1996,
+  1871, 1112, 1777, 359, -1, 1271, -1, 1725, -1, 1209, -1, -1,
+  247, 1145, -1, 979, -1, 875, 2064, -1, 422, -1, -1, -1,
+  -1, -1, 344, -1, -1, -1, 219, -1, -1, 1733, 332, 1598,
+  871, 991, 444, 2109, 1817, 1465, 1088, -1, 26, 1033, -1, -1,
+  -1, 1333, 1288, 766, 882, -1, -1, -1, -1, 136, 438, 1359,
+  485, 740, 2194, -1, 244, 770, 1563, 1276, 30, -1, -1, -1,
+  -1, 2189, 330, 185, 1097, -1, 863, -1, 1371, -1, 202, 496,
+  -1, -1, -1, -1, 1416, -1, 779, -1, -1, 2191, -1, -1,
+  761, 1467, -1, 862, 968, 1654, 1495, 540, -1, -1, -1, -1,
+  -1, 1750, 2004, 580, -1, -1, 1569, 2188, -1, 1204, -1, 722,
+  1086, 1323, 15, -1, 756, -1, 152, 633, -1, 290, -1, 1335,
+  1981, -1, 2024, -1, -1, 687, 1552, -1, 734, -1, 100, 963,
+  1456, -1, -1, 1492, 2157, -1, 1510, -1, 1636, -1, 517, 52,
+  620, -1, -1, 1679, -1, -1, -1, -1, 712, 1139, -1, -1,
+  1899, 217, -1, 1965, 1231, -1, -1, -1, 92, -1, 665, 195,
+  -1, 1745, 941, -1, -1, -1, 349, 1015, 1877, -1, -1, 505,
+  1253, 19, 1343, 192, 916, 60, -1, 603, -1, -1, 2015, 677,
+  1390, -1, -1, -1, 775, -1, -1, -1, -1, 1762, 1246, -1,
+  -1, 610, -1, -1, -1, -1, 188, 787, 1238, 1237, -1, -1,
+  530, 814, 1388, 178, -1, 1403, 549, 682, -1, -1, -1, 1257,
+  1890, 234, -1, 173, 599, 755, 113, -1, 543, -1, 1949, 1955,
+  -1, 1869, -1, -1, 2000, -1, -1, 223, -1, 1009, -1, 329,
+  -1, 298, -1, -1, 785, 104, -1, -1, 715, -1, 606, 1044,
+  2057, 2099, 774, 1945, 1967, -1, -1, 1279, -1, -1, 1940, 2092,
+  2046, -1, -1, -1, 387, -1, -1, 37, -1, -1, -1, -1,
+  353, -1, 406, 1874, 1030, -1, -1, -1, 469, 1230, 1063, -1,
+  2137, -1, -1, -1, -1, -1, 386, 1442, -1, 531, 958, 423,
+  1378, -1, 197, 1187, -1, -1, -1, 1878, -1, 248, 2008, -1,
+  1860, -1, 1613, 563, -1, -1, -1, -1, 2152, 468, 1787, 1573,
+  658, 834, -1, 1969, 205, 51, 1718, -1, 577, -1, 996, -1,
+  408, 40, 1157, 1514, 388, 2150, 829, 460, 1199, 1732, 993, -1,
+  1338, -1, -1, 2100, 884, 816, 1365, 1188, 709, -1, -1, 1714,
+  782, 523, -1, 967, -1, -1, -1, -1, 167, 536, 1612, 773,
+  1950, 680, -1, 407, 34, 838, 1622, 1133, -1, 1468, 41, -1,
+  561, -1, -1, 1672, 1117, 971, -1, 764, -1, -1, 615, 1011,
+  -1, -1, 1818, -1, -1, -1, 1528, -1, -1, -1, -1, 995,
+  1405, 1678, 1566, -1, 2122, -1, -1, -1, -1, -1, 1164, -1,
+  873, 1912, -1, 454, -1, 928, -1, 351, 900, 1740, 323, 821,
+  341, 2222, 1734, 18, 1092, -1, -1, 647, 1508, 706, 1992, 612,
+  -1, -1, 583, 2080, -1, -1, 1579, 53, 629, 1575, 1341, -1,
+  1066, 1529, -1, -1, 1793, 784, 440, 280, 2082, 1216, -1, 1752,
+  1629, -1, 1217, -1, 435, 1908, -1, 769, 1267, 914, 452, 1106,
+  230, -1, 1265, 1207, 1473, 1401, 2165, 1064, 1603, 823, -1, -1,
+  -1, -1, 1025, -1, 1504, 6, -1, -1, 545, -1, 1289, -1,
+  -1, 1951, -1, -1, -1, 1977, -1, 33, -1, 1177, 463, 1686,
+  1518, 1918, 896, -1, -1, 946, 738, 1073, -1, 1372, 1309, -1,
+  1128, -1, -1, 1995, 728, -1, 2151, 2130, -1, 1914, -1, 1031,
+  1460, -1, 1065, 2116, -1, -1, -1, 1824, 686, -1, 1812, 696,
+  -1, 296, 978, -1, 783, 295, -1, 902, 1641, 839, -1, 569,
+  1287, 1426, 14, -1, -1, 1420, -1, -1, -1, 1685, 670, -1,
+  366, 2139, 1754, -1, 1536, 1090, -1, -1, -1, -1, 1700, -1,
+  -1, -1, -1, 1867, -1, 1191, 1273, -1, 2072, 1619, -1, -1,
+  -1, -1, 285, 1050, -1, -1, 704, 1607, 1683, -1, -1, -1,
+  1883, 2123, -1, 989, 293, -1, -1, 1101, 1892, 767, 919, -1,
+  -1, 83, 1873, -1, 921, -1, 608, -1, 1532, 443, -1, -1,
+  1797, -1, -1, -1, 157, 1585, -1, -1, 753, 2038, -1, 1061,
+  781, -1, 1902, 575, -1, -1, 607, 1472, 1223, 61, -1, 604,
+  2088, 1057, -1, -1, 772, 1915, 1870, 367, -1, 2213, -1, -1,
+  -1, 1747, -1, 203, 1963, -1, -1, 1023, 196, 1596, -1, 1819,
+  403, 1450, -1, -1, -1, 1803, -1, 1186, 792, 892, -1, 393,
+  2166, 85, -1, 980, -1, -1, 2134, 859, -1, 1215, -1, -1,
+  2128, 380, 1727, -1, 1853, 2027, -1, -1, -1, 552, -1, -1,
+  -1, -1, 1093, -1, -1, -1, -1, 1519, 591, 80, -1, 1681,
+  947, -1, -1, 2005, 306, 953, -1, 526, -1, -1, 1764, -1,
+  -1, 1488, -1, -1, -1, -1, 480, -1, 638, -1, 1978, 1881,
+  -1, -1, -1, 128, -1, 132, 2079, -1, -1, -1, 204, 208,
+  1301, 1433, -1, 174, 1242, 1299, -1, 833, -1, 691, -1, 1274,
+  2108, -1, -1, -1, -1, 74, -1, -1, -1, -1, 1801, -1,
+  1354, 93, -1, -1, -1, 960, -1, 1074, 918, -1, 1644, -1,
+  703, 282, -1, 1909, -1, 1016, 233, -1, 1663, -1, 337, -1,
+  122, -1, -1, -1, 1691, 176, -1, 271, -1, 1948, -1, -1,
+  -1, 1383, -1, -1, 828, -1, 849, 1952, 1252, -1, -1, -1,
+  -1, 16, -1, -1, 169, -1, -1, -1, 326, -1, 137, 652,
+  -1, 1572, -1, 1751, 1667, -1, 649, 2158, 1635, -1, -1, 148,
+  -1, -1, -1, 96, -1, 2205, -1, 1154, 870, 982, -1, -1,
+  931, 292, -1, -1, -1, 1091, -1, -1, -1, 1122, 1053, -1,
+  1283, -1, 1158, 1458, -1, 2074, -1, 130, 439, 432, -1, 1041,
+  1077, 237, -1, -1, 1916, 726, 456, -1, 1547, 1554, -1, 1882,
+  2125, -1, 2103, -1, -1, 2011, 723, -1, -1, -1, -1, 1854,
+  -1, -1, -1, 327, 1696, 1396, -1, -1, 699, 2173, 1342, 515,
+  1695, -1, -1, 672, -1, 692, -1, -1, 933, 661, -1, 263,
+  539, -1, -1, 702, 1463, 760, 442, 331, 303, 1512, -1, 1024,
+  922, -1, -1, 673, 910, -1, -1, -1, -1, 129, -1, -1,
+  -1, -1, 1054, -1, 1788, 669, 1975, 854, -1, 1800, 1947, -1,
+  2010, -1, 1431, -1, -1, 1148, 316, 413, -1, -1, -1, -1,
+  1567, -1, 308, -1, 1357, -1, 1999, 937, 118, -1, 177, 1126,
+  -1, -1, 106, 1701, -1, -1, 1427, -1, 199, 1499, -1, 955,
+  1140, -1, 1087, 2033, -1, 503, 1748, 2053, 1675, 8, -1, -1,
+  1173, 1568, -1, -1, 644, -1, 1617, -1, -1, 1988, -1, 797,
+  2149, 1720, 765, 2175, 2085, 694, 1368, -1, -1, 471, -1, 2212,
+  107, -1, 475, -1, -1, -1, -1, 1840, 429, 141, 114, 1152,
+  -1, 416, -1, 1196, -1, 490, 899, 35, 1924, 116, 1682, 236,
+  1652, 1453, 1201, 1886, 1083, 793, -1, -1, 2049, -1, 428, 90,
+  488, 809, 1038, -1, 2045, 11, -1, -1, 987, -1, 1974, -1,
+  -1, 965, -1, -1, 2111, 789, 111, 1351, 1863, 1376, 1655, -1,
+  1697, 421, -1, -1, 1766, -1, -1, -1, 865, -1, -1, 1809,
+  2115, 622, -1, 1994, -1, 472, -1, 209, -1, 858, 2170, 721,
+  2097, 1411, -1, 455, -1, -1, -1, -1, -1, -1, -1, -1,
+  1913, 190, 2019, -1, -1, -1, 1631, 600, -1, 121, 2198, -1,
+  399, 660, 1441, 1479, 1906, 997, 893, 1885, 768, 198, 2207, -1,
+  -1, 1806, -1, 1496, 698, 560, -1, 903, 1125, 1332, 1843, -1,
+  239, -1, 1375, 628, -1, -1, 42, 732, -1, -1, -1, 2217,
+  -1, 800, 2003, 86, 2140, 1477, -1, 94, -1, -1, 521, 1113,
+  -1, 465, -1, 1541, -1, -1, -1, -1, -1, -1, -1, -1,
+  -1, 1649, 1957, -1, 868, -1, 1645, 23, -1, 2203, -1, -1,
+  -1, -1, 1772, 975, -1, 1891, 312, 1459, 1712, -1, 1717, -1,
+  -1, -1, 846, -1, 683, -1, -1, 1582, 2154, -1, 87, -1,
+  -1, -1, 1233, 1986, 2068, -1, 1318, -1, 1971, 1926, 1440, 2026,
+  -1, 2230, 751, -1, 2126, 117, 1012, -1, 260, -1, -1, -1,
+  1664, 1474, -1, 866, 559, -1, -1, 924, 339, 2131, -1, -1,
+  1424, 1302, -1, 576, 1153, 50, -1, -1, -1, -1, 310, 1968,
+  -1, 466, 1308, -1, -1, -1, -1, -1, 894, -1, 62, 189,
+  827, -1, 1028, 309, 246, -1, -1, -1, -1, 810, 1205, 1917,
+  585, -1, -1, 1, 1347, -1, -1, 453, 1198, 405, 1839, -1,
+  748, 213, -1, 297, -1, 1577, -1, -1, -1, 1609, 516, 803,
+  2031, -1, 1832, 1415, -1, 874, 45, 744, 1150, 1707, 284, 1872,
+  998, 848, 1526, -1, -1, 513, -1, -1, 2042, 1296, 2012, 1503,
+  -1, 1921, 275, -1, 1060, 276, -1, 1509, 1189, -1, 1930, 1997,
+  -1, 350, -1, -1, -1, 537, 66, -1, -1, 654, 2067, 1543,
+  -1, 663, -1, 123, 1721, -1, 1634, 2225, -1, 602, 818, -1,
+  679, -1, -1, -1, -1, 1272, 1212, 1935, 1850, -1, 2127, -1,
+  2029, -1, 2135, 1353, -1, 1662, -1, -1, 2187, 1953, 1200, -1,
+  1758, 2090, -1, 812, 1743, 347, -1, -1, -1, -1, -1, 1829,
+  1888, -1, -1, 32, -1, 1710, -1, 662, 1783, -1, 1535, -1,
+  -1, 1605, -1, -1, 1169, 384, -1, 735, -1, 313, 727, 690,
+  1693, -1, -1, -1, 1269, -1, -1, 1363, -1, 149, -1, -1,
+  711, -1, -1, 270, -1, -1, -1, -1, 207, -1, 1627, 1270,
+  -1, -1, -1, -1, -1, -1, 1841, -1, 2220, 1755, 2196, 1811,
+  -1, -1, -1, 1167, -1, 71, 1807, 59, 1258, 194, -1, 300,
+  889, 567, 1688, -1, -1, -1, -1, 1775, -1, -1, -1, -1,
+  103, -1, 840, 1611, 925, 1621, 175, -1, -1, -1, -1, -1,
+  1345, 2060, -1, 97, -1, -1, 885, 1923, 1336, -1, -1, -1,
+  -1, 1601, -1, -1, -1, 154, -1, -1, 318, 289, 1736, 1312,
+  498, 891, 1494, -1, 642, 481, 259, 450, -1, -1, -1, -1,
+  105, -1, 2016, 578, 1560, 2117, -1, 1520, 1180, -1, 525, 920,
+  1141, 1379, -1, 1845, -1, -1, 1410, -1, 945, -1, 2083, 964,
+  676, -1, 115, -1, -1, 883, 29, 1922, -1, -1, 1837, 2110,
+  -1, -1, 0, 1669, 1657, 912, -1, -1, 1211, -1, 742, 1387,
+  81, -1, -1, -1, -1, -1, -1, -1, 424, -1, 1043, -1,
+  1389, 806, -1, -1, -1, -1, 1709, -1, 1643, -1, 1706, -1,
+  -1, 1724, 110, 1138, 46, -1, -1, -1, 425, 1827, -1, 1545,
+  1408, 91, -1, 43
+};
+
+static const int kNumEntityBuckets = sizeof(kEntitySeeds) / sizeof(kEntitySeeds[0]);
+static const int kNumEntitySlots = sizeof(kEntitySlots) / sizeof(kEntitySlots[0]);
+static const int kMaxLegacyName = 6;
+static const int kMinLegacyName = 2;
+
+// 32-bit FNV-1a, with the seed folded into the offset basis
+static uint32_t HashEntityName(const char *name, int length, uint32_t seed)
+{
+  uint32_t hash = 2166136261u ^ seed;
+  for (int i = 0; i < length; i++) {
+    hash ^= (unsigned char)name[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+const char *LookupHTMLEntity(const char *name, int length, int *valueLength)
+{
+  if (length <= 0 || length > HTML_ENTITY_MAX_NAME) return NULL;
+
+  uint32_t bucket = HashEntityName(name, length, 0) % kNumEntityBuckets;
+  uint32_t seed = kEntitySeeds[bucket];
+  int index = kEntitySlots[HashEntityName(name, length, seed) % kNumEntitySlots];
+  if (index < 0) return NULL;
+
+  const htmlentity *entity = &kEntities[index];
+  if (entity->nameLength != length || memcmp(entity->name, name, length) != 0) return NULL;
+  *valueLength = entity->valueLength;
+  return entity->value;
+}
+
+const char *MatchHTMLEntity(const char *text, int *nameLength, int *valueLength)
+{
+  int length = 0;
+  while (length < HTML_ENTITY_MAX_NAME - 1 && isalnum((unsigned char)text[length])) length++;
+  if (length == 0) return NULL;
+
+  const char *value;
+  if (text[length] == ';') {
+    value = LookupHTMLEntity(text, length + 1, valueLength);
+    if (value != NULL) {
+      *nameLength = length + 1;
+      return value;
+    }
+  }
+
+  // fall back on the longest legacy name that prefixes the text
+  if (length > kMaxLegacyName) length = kMaxLegacyName;
+  for (; length >= kMinLegacyName; length--) {
+    value = LookupHTMLEntity(text, length, valueLength);
+    if (value != NULL) {
+      *nameLength = length;
+      return value;
+    }
+  }
+  return NULL;
+}
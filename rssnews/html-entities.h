@@ -0,0 +1,50 @@
+#ifndef _htmlentities_
+#define _htmlentities_
+
+/**
+ * File: html-entities.h
+ * ---------------------
+ * Defines the lookup of HTML5 named character references ("&amp;",
+ * "&hellip;", "&NewLine;" and the other 2,200-odd names in the WHATWG
+ * table) by way of a perfect hash, so that finding a name costs time
+ * proportional to its length and never a search.
+ */
+
+/**
+ * Constant: HTML_ENTITY_MAX_NAME
+ * ------------------------------
+ * The length of the longest entity name, counting its ';'.  No name
+ * longer than this can match, so scanners can stop looking past it.
+ */
+
+#define HTML_ENTITY_MAX_NAME 32
+
+/**
+ * Function: LookupHTMLEntity
+ * Usage: const char *value = LookupHTMLEntity("hellip;", 7, &valueLength);
+ * -------------------------
+ * Returns the UTF-8 expansion of the entity with exactly the given name
+ * (without the leading '&' but including the ';', if any), or NULL if
+ * there's no such entity.  The expansion isn't null-terminated; its
+ * length in bytes is written to *valueLength.
+ */
+
+const char *LookupHTMLEntity(const char *name, int length, int *valueLength);
+
+/**
+ * Function: MatchHTMLEntity
+ * Usage: const char *value = MatchHTMLEntity(amp + 1, &nameLength, &valueLength);
+ * ------------------------
+ * Matches the named reference at the front of the null-terminated text,
+ * which should point just past a '&', the way an HTML5 parser does in
+ * element content: a name normally has to end in ';', but the hundred or
+ * so legacy names browsers accept without one ("amp", "lt", "nbsp", ...)
+ * also match bare, with the longest such prefix winning, so "&notin"
+ * expands to "¬in".  On success, returns the expansion as LookupHTMLEntity
+ * does and sets *nameLength to the number of characters of text matched.
+ * Returns NULL if nothing matches.
+ */
+
+const char *MatchHTMLEntity(const char *text, int *nameLength, int *valueLength);
+
+#endif
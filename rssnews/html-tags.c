@@ -0,0 +1,109 @@
+#include "html-tags.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+
+/**
+ * kTagNames is indexed by htmltag and was generated, together with the
+ * enum, from the vocabulary described in html-tags.h.  Lookups go through
+ * a "hash and displace" perfect hash, like the entities in html-entities.c,
+ * but one that hashes the name only once, since a tag name is classified
+ * for every tag in a document.  The name, folded to lower case, hashes to
+ * one of 64 buckets, and the bucket's entry in kTagSeeds is the seed that,
+ * mixed into the same hash, lands the name in its own slot of kTagSlots.
+ * That slot holds the tag (or kTagUnknown if no name landed there).  The
+ * seeds were found offline, largest bucket first.
+ */
+
+static const char *const kTagNames[kNumTags] = {
+  NULL, "a", "abbr", "acronym", "address", "applet", "area", "article", "aside", "audio",
+  "author", "b", "base", "basefont", "bdi", "bdo", "big", "blink", "blockquote", "body", "br",
+  "button", "canvas", "caption", "category", "center", "channel", "cite", "cloud", "code",
+  "col", "colgroup", "comments", "content", "contributor", "copyright", "creator", "data",
+  "datalist", "date", "day", "dd", "del", "description", "details", "dfn", "dialog", "dir",
+  "div", "dl", "docs", "dt", "em", "email", "embed", "enclosure", "encoded", "entry", "feed",
+  "fieldset", "figcaption", "figure", "font", "footer", "form", "frame", "frameset",
+  "generator", "guid", "h1", "h2", "h3", "h4", "h5", "h6", "head", "header", "height", "hgroup",
+  "hour", "hr", "html", "i", "icon", "id", "iframe", "image", "img", "input", "ins", "isindex",
+  "item", "kbd", "label", "language", "lastBuildDate", "legend", "li", "link", "listing",
+  "logo", "main", "managingEditor", "map", "mark", "marquee", "math", "menu", "meta", "meter",
+  "name", "nav", "nobr", "noembed", "noframes", "noscript", "object", "ol", "optgroup",
+  "option", "output", "p", "param", "picture", "plaintext", "pre", "progress", "pubDate",
+  "published", "q", "rating", "RDF", "rights", "rp", "rss", "rt", "ruby", "s", "samp", "script",
+  "search", "section", "select", "skipDays", "skipHours", "slot", "small", "source", "span",
+  "strike", "strong", "style", "sub", "subtitle", "summary", "sup", "svg", "table", "tbody",
+  "td", "template", "textarea", "textInput", "tfoot", "th", "thead", "time", "title", "tr",
+  "track", "tt", "ttl", "u", "ul", "updated", "uri", "url", "var", "video", "wbr", "webMaster",
+  "width", "xmp"
+};
+
+static const unsigned char kTagSeeds[64] = {
+  0, 5, 1, 7, 1, 14, 6, 7, 2, 1, 9, 16, 9, 6, 1, 4,
+  5, 5, 5, 2, 4, 3, 1, 6, 21, 1, 4, 12, 2, 0, 1, 3,
+  1, 6, 13, 1, 2, 1, 1, 4, 0, 12, 2, 2, 5, 2, 0, 2,
+  39, 3, 9, 2, 2, 1, 2, 7, 0, 3, 8, 1, 5, 1, 9, 5
+};
+
+static const unsigned char kTagSlots[256] = {
+  51, 0, 0, 182, 170, 8, 56, 62, 0, 47, 0, 77, 0, 97, 94, 18,
+  0, 0, 178, 61, 0, 11, 40, 121, 6, 81, 0, 145, 0, 82, 95, 142,
+  148, 133, 152, 0, 19, 13, 23, 0, 143, 177, 0, 0, 176, 76, 87, 171,
+  0, 0, 159, 0, 120, 0, 0, 32, 24, 0, 0, 0, 53, 67, 0, 0,
+  146, 119, 46, 106, 28, 167, 49, 9, 0, 54, 88, 74, 160, 0, 110, 132,
+  86, 0, 144, 115, 22, 181, 0, 92, 31, 60, 0, 17, 0, 38, 161, 91,
+  134, 164, 0, 140, 52, 101, 26, 0, 180, 27, 69, 149, 0, 0, 72, 0,
+  35, 130, 156, 90, 0, 0, 78, 0, 59, 66, 70, 139, 0, 100, 104, 0,
+  14, 0, 50, 44, 128, 12, 36, 21, 0, 96, 131, 99, 0, 150, 0, 166,
+  57, 1, 7, 153, 125, 73, 174, 93, 79, 0, 0, 42, 0, 126, 0, 172,
+  0, 112, 15, 108, 141, 65, 147, 33, 105, 118, 158, 169, 84, 136, 0, 0,
+  10, 138, 168, 0, 137, 48, 68, 0, 0, 0, 0, 175, 0, 30, 109, 89,
+  122, 4, 64, 155, 0, 127, 58, 20, 34, 16, 113, 162, 0, 117, 129, 0,
+  98, 0, 41, 173, 39, 114, 0, 0, 85, 63, 0, 165, 0, 37, 75, 83,
+  157, 55, 2, 111, 29, 80, 102, 0, 0, 154, 124, 151, 43, 0, 0, 0,
+  25, 3, 135, 116, 71, 107, 179, 5, 0, 163, 0, 0, 0, 45, 103, 123
+};
+
+static const int kNumTagBuckets = sizeof(kTagSeeds) / sizeof(kTagSeeds[0]);
+
+static unsigned char FoldCase(unsigned char ch)
+{
+  return (ch >= 'A' && ch <= 'Z') ? ch | 0x20 : ch;
+}
+
+// picks the name's slot out of kTagSlots' 256 by way of the top byte of a multiplicative hash
+static int TagSlot(uint32_t hash, uint32_t seed)
+{
+  return ((hash ^ seed) * 2654435761u) >> 24;
+}
+
+htmltag ClassifyTag(const char *name, int length)
+{
+  assert(name != NULL && length >= 0);
+
+  // 32-bit FNV-1a over the folded name, started afresh after any namespace prefix
+  const char *local = name;
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < length; i++) {
+    if (name[i] == ':') {
+      local = name + i + 1;
+      hash = 2166136261u;
+      continue;
+    }
+    hash ^= FoldCase(name[i]);
+    hash *= 16777619u;
+  }
+  length -= local - name;
+
+  htmltag tag = kTagSlots[TagSlot(hash, kTagSeeds[hash % kNumTagBuckets])];
+  const char *candidate = kTagNames[tag];
+  if (candidate == NULL) return kTagUnknown;
+  for (int i = 0; i < length; i++)
+    if (candidate[i] == '\0' || FoldCase(local[i]) != FoldCase(candidate[i])) return kTagUnknown;
+  return (candidate[length] == '\0') ? tag : kTagUnknown;
+}
+
+const char *TagName(htmltag tag)
+{
+  assert(tag >= kTagUnknown && tag < kNumTags);
+  return kTagNames[tag];
+}
@@ -0,0 +1,76 @@
+#ifndef _htmltags_
+#define _htmltags_
+
+/**
+ * File: html-tags.h
+ * -----------------
+ * Defines the classification of tag names, so that code reacting to
+ * particular tags can switch on an enum rather than compare strings.  The
+ * vocabulary covers every HTML5 element, the obsolete ones still found in
+ * the wild (<center>, <font>, <frame> and so on), and the elements of RSS
+ * and Atom feeds.  Names are looked up by way of a perfect hash, in time
+ * proportional to their length.
+ */
+
+/**
+ * Type: htmltag
+ * -------------
+ * One constant per known tag name, named after it: kTagScript for
+ * "script", kTagPubDate for "pubDate", kTagH1 for "h1".  A name that's
+ * an HTML element and a feed element both (<title>, <link>, <source>)
+ * has just the one constant.  Anything unrecognized is kTagUnknown, which
+ * is 0.  kNumTags isn't a tag; it's the number of constants, kTagUnknown
+ * included.
+ */
+
+typedef enum {
+  kTagUnknown,
+  kTagA, kTagAbbr, kTagAcronym, kTagAddress, kTagApplet, kTagArea, kTagArticle, kTagAside,
+  kTagAudio, kTagAuthor, kTagB, kTagBase, kTagBasefont, kTagBdi, kTagBdo, kTagBig, kTagBlink,
+  kTagBlockquote, kTagBody, kTagBr, kTagButton, kTagCanvas, kTagCaption, kTagCategory,
+  kTagCenter, kTagChannel, kTagCite, kTagCloud, kTagCode, kTagCol, kTagColgroup, kTagComments,
+  kTagContent, kTagContributor, kTagCopyright, kTagCreator, kTagData, kTagDatalist, kTagDate,
+  kTagDay, kTagDd, kTagDel, kTagDescription, kTagDetails, kTagDfn, kTagDialog, kTagDir, kTagDiv,
+  kTagDl, kTagDocs, kTagDt, kTagEm, kTagEmail, kTagEmbed, kTagEnclosure, kTagEncoded, kTagEntry,
+  kTagFeed, kTagFieldset, kTagFigcaption, kTagFigure, kTagFont, kTagFooter, kTagForm, kTagFrame,
+  kTagFrameset, kTagGenerator, kTagGuid, kTagH1, kTagH2, kTagH3, kTagH4, kTagH5, kTagH6,
+  kTagHead, kTagHeader, kTagHeight, kTagHgroup, kTagHour, kTagHr, kTagHtml, kTagI, kTagIcon,
+  kTagId, kTagIframe, kTagImage, kTagImg, kTagInput, kTagIns, kTagIsindex, kTagItem, kTagKbd,
+  kTagLabel, kTagLanguage, kTagLastBuildDate, kTagLegend, kTagLi, kTagLink, kTagListing,
+  kTagLogo, kTagMain, kTagManagingEditor, kTagMap, kTagMark, kTagMarquee, kTagMath, kTagMenu,
+  kTagMeta, kTagMeter, kTagName, kTagNav, kTagNobr, kTagNoembed, kTagNoframes, kTagNoscript,
+  kTagObject, kTagOl, kTagOptgroup, kTagOption, kTagOutput, kTagP, kTagParam, kTagPicture,
+  kTagPlaintext, kTagPre, kTagProgress, kTagPubDate, kTagPublished, kTagQ, kTagRating, kTagRDF,
+  kTagRights, kTagRp, kTagRss, kTagRt, kTagRuby, kTagS, kTagSamp, kTagScript, kTagSearch,
+  kTagSection, kTagSelect, kTagSkipDays, kTagSkipHours, kTagSlot, kTagSmall, kTagSource,
+  kTagSpan, kTagStrike, kTagStrong, kTagStyle, kTagSub, kTagSubtitle, kTagSummary, kTagSup,
+  kTagSvg, kTagTable, kTagTbody, kTagTd, kTagTemplate, kTagTextarea, kTagTextInput, kTagTfoot,
+  kTagTh, kTagThead, kTagTime, kTagTitle, kTagTr, kTagTrack, kTagTt, kTagTtl, kTagU, kTagUl,
+  kTagUpdated, kTagUri, kTagUrl, kTagVar, kTagVideo, kTagWbr, kTagWebMaster, kTagWidth, kTagXmp,
+  kNumTags
+} htmltag;
+
+/**
+ * Function: ClassifyTag
+ * Usage: switch (ClassifyTag(name, nameLength)) { case kTagScript: ... }
+ * ---------------------
+ * Returns the constant for the tag with the given name, which needn't be
+ * null-terminated, or kTagUnknown if it isn't one of the known tags.  Case
+ * doesn't matter, so "SCRIPT", "Script" and "script" are all kTagScript,
+ * and any namespace prefix is ignored, so "atom:link" is kTagLink and
+ * "content:encoded" is kTagEncoded.
+ */
+
+htmltag ClassifyTag(const char *name, int length);
+
+/**
+ * Function: TagName
+ * Usage: printf("<%s>\n", TagName(tag));
+ * -----------------
+ * Returns the name of the specified tag, spelled as it is in the HTML and
+ * feed specifications ("pubDate", not "pubdate"), or NULL for kTagUnknown.
+ */
+
+const char *TagName(htmltag tag);
+
+#endif
@@ -0,0 +1,299 @@
+#include "html-tokenizer.h"
+#include "html-tags.h"
+#include <limits.h>
+#include <string.h>
+#include <strings.h>
+#include <assert.h>
+
+/**
+ * HTMLTokenize works directly on the streamtokenizer's unread input, as
+ * exposed by STPeek.  Text is handed on a window's worth at a time, so it
+ * never forces the window to grow; a run that outlasts the window is cut
+ * at its last white space, and the rest waits for the next read.  But a
+ * tag, comment or CDATA section has to be seen in its entirety before it
+ * can be reported, so the window grows (by doubling) whenever one doesn't
+ * fit.  Searches that read ahead hold on to offsets from the cursor, since
+ * reading ahead may move the input.
+ */
+
+typedef struct {
+  streamtokenizer *st;
+  const htmlhandlers *handlers;
+  void *auxData;
+  htmltag rawTag;               // kTagScript or kTagStyle while inside one, else kTagUnknown
+  int rawTagLength;
+} htmltokenizer;
+
+// text without white space is cut into pieces this long rather than held back any further
+static const size_t kLongestHeldText = 4096;
+
+// long enough to recognize any construct from its opening characters
+static const size_t kLongestOpening = sizeof("<![CDATA[") - 1;
+
+static bool IsTagSpace(char ch)
+{
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\f';
+}
+
+static bool IsTagNameStart(char ch)
+{
+  return (ch | 0x20) >= 'a' && (ch | 0x20) <= 'z';
+}
+
+// hands a run of characters to fn, if there is one, in pieces an int can count
+static void Emit(HTMLTextFunction fn, const char *text, size_t length, void *auxData)
+{
+  if (fn == NULL) return;
+  while (length > 0) {
+    int piece = (length > INT_MAX) ? INT_MAX : (int) length;
+    fn(text, piece, auxData);
+    text += piece;
+    length -= piece;
+  }
+}
+
+/**
+ * Returns the offset from the cursor of the first occurrence of pattern
+ * that begins at or after offset from, reading ahead as far as it takes,
+ * or -1 if the input runs out first.
+ */
+
+static long FindAhead(streamtokenizer *st, size_t from, const char *pattern, size_t patternLength)
+{
+  const char *bytes;
+  size_t available = STPeek(st, from + patternLength, &bytes);
+
+  while (true) {
+    if (available >= from + patternLength) {
+      const char *p = bytes + from;
+      const char *last = bytes + available - patternLength;   // last place a match could start
+      while (p <= last) {
+        p = memchr(p, pattern[0], last - p + 1);
+        if (p == NULL) break;
+        if (memcmp(p, pattern, patternLength) == 0) return p - bytes;
+        p++;
+      }
+      from = last - bytes + 1;
+    }
+
+    size_t more = STPeek(st, available + 1, &bytes);
+    if (more == available) return -1;
+    available = more;
+  }
+}
+
+/**
+ * Returns the offset from the cursor of the '>' that closes the tag
+ * beginning there, or -1 if the input runs out first.  A '>' inside a
+ * quoted attribute value doesn't count, but a quote only opens a value
+ * when it's the first thing after an '='.
+ */
+
+static long FindTagEnd(streamtokenizer *st, size_t from)
+{
+  enum { kInTag, kAfterEquals, kInUnquotedValue } state = kInTag;
+  const char *bytes;
+  size_t available = STPeek(st, from + 1, &bytes);
+
+  for (size_t i = from; ; i++) {
+    if (i >= available) {
+      available = STPeek(st, i + 1, &bytes);
+      if (i >= available) return -1;
+    }
+
+    char ch = bytes[i];
+    if (ch == '>') return i;
+    switch (state) {
+      case kInTag:
+        if (ch == '=') state = kAfterEquals;
+        break;
+      case kAfterEquals:
+        if (ch == '"' || ch == '\'') {
+          long close = FindAhead(st, i + 1, &ch, 1);
+          if (close < 0) return -1;
+          available = STPeek(st, 0, &bytes);
+          i = close;
+          state = kInTag;
+        } else if (!IsTagSpace(ch)) {
+          state = kInUnquotedValue;
+        }
+        break;
+      case kInUnquotedValue:
+        if (IsTagSpace(ch)) state = kInTag;
+        break;
+    }
+  }
+}
+
+static void TokenizeAttributes(const htmltokenizer *ht, const char *p, const char *close)
+{
+  while (true) {
+    while (p < close && (IsTagSpace(*p) || *p == '/')) p++;
+    if (p == close) return;
+
+    // the first character of a name can be anything, even '='
+    const char *name = p++;
+    while (p < close && !IsTagSpace(*p) && *p != '/' && *p != '=') p++;
+    int nameLength = p - name;
+
+    const char *value = p;
+    int valueLength = 0;
+    const char *q = p;
+    while (q < close && IsTagSpace(*q)) q++;
+    if (q < close && *q == '=') {
+      q++;
+      while (q < close && IsTagSpace(*q)) q++;
+      if (q < close && (*q == '"' || *q == '\'')) {
+        value = q + 1;
+        q = memchr(value, *q, close - value);
+        if (q == NULL) q = close;
+        valueLength = q - value;
+        p = (q < close) ? q + 1 : close;
+      } else {
+        value = q;
+        while (q < close && !IsTagSpace(*q)) q++;
+        valueLength = q - value;
+        p = q;
+      }
+    }
+
+    ht->handlers->attribute(name, nameLength, value, valueLength, ht->auxData);
+  }
+}
+
+static void TokenizeTag(htmltokenizer *ht, bool isEndTag)
+{
+  streamtokenizer *st = ht->st;
+  const htmlhandlers *handlers = ht->handlers;
+  const char *bytes;
+
+  size_t nameStart = isEndTag ? 2 : 1;
+  long end = FindTagEnd(st, nameStart);
+  size_t available = STPeek(st, 0, &bytes);
+  if (end < 0) {
+    STAdvance(st, available);
+    return;
+  }
+
+  const char *close = bytes + end;
+  const char *name = bytes + nameStart;
+  const char *p = name;
+  while (p < close && !IsTagSpace(*p) && *p != '/') p++;
+  int nameLength = p - name;
+
+  if (isEndTag) {
+    if (handlers->endTag != NULL) handlers->endTag(name, nameLength, false, ht->auxData);
+    if (ht->rawTag != kTagUnknown && nameLength == ht->rawTagLength &&
+        ClassifyTag(name, nameLength) == ht->rawTag) ht->rawTag = kTagUnknown;
+  } else {
+    bool selfClosing = close[-1] == '/' && close - 1 >= p;
+    if (handlers->startTag != NULL) handlers->startTag(name, nameLength, selfClosing, ht->auxData);
+    if (handlers->attribute != NULL) TokenizeAttributes(ht, p, close);
+    htmltag tag = ClassifyTag(name, nameLength);
+    if ((tag == kTagScript || tag == kTagStyle) && !selfClosing &&
+        (size_t) nameLength == strlen(TagName(tag))) {    // no namespace prefix
+      ht->rawTag = tag;
+      ht->rawTagLength = nameLength;
+    }
+  }
+
+  STAdvance(st, end + 1);
+}
+
+// reports (or skips) everything between the opening and the close, which it consumes as well
+static void TokenizeDelimited(htmltokenizer *ht, size_t openingLength, const char *close,
+                              HTMLTextFunction fn)
+{
+  const char *bytes;
+  size_t closeLength = strlen(close);
+  long end = FindAhead(ht->st, openingLength, close, closeLength);
+  size_t available = STPeek(ht->st, 0, &bytes);
+
+  if (end < 0) {
+    if (available > openingLength) Emit(fn, bytes + openingLength, available - openingLength, ht->auxData);
+    STAdvance(ht->st, available);
+  } else {
+    Emit(fn, bytes + openingLength, end - openingLength, ht->auxData);
+    STAdvance(ht->st, end + closeLength);
+  }
+}
+
+// true if bytes begins the end tag that closes the current raw text element
+static bool IsRawTextEnd(const htmltokenizer *ht, const char *bytes, size_t available)
+{
+  size_t length = 2 + ht->rawTagLength;
+  return available > length && bytes[1] == '/' &&
+    strncasecmp(bytes + 2, TagName(ht->rawTag), ht->rawTagLength) == 0 &&
+    (IsTagSpace(bytes[length]) || bytes[length] == '/' || bytes[length] == '>');
+}
+
+static void TokenizeMarkup(htmltokenizer *ht)
+{
+  const htmlhandlers *handlers = ht->handlers;
+  const char *bytes;
+
+  if (ht->rawTag != kTagUnknown) {
+    size_t available = STPeek(ht->st, 3 + ht->rawTagLength, &bytes);
+    if (IsRawTextEnd(ht, bytes, available)) {
+      TokenizeTag(ht, true);
+    } else {
+      Emit(handlers->rawText, bytes, 1, ht->auxData);
+      STAdvance(ht->st, 1);
+    }
+    return;
+  }
+
+  size_t available = STPeek(ht->st, kLongestOpening, &bytes);
+  if (available >= 4 && memcmp(bytes, "<!--", 4) == 0) {
+    TokenizeDelimited(ht, 4, "-->", handlers->comment);
+  } else if (available >= 9 && memcmp(bytes, "<![CDATA[", 9) == 0) {
+    TokenizeDelimited(ht, 9, "]]>", handlers->cdata);
+  } else if (available >= 2 && IsTagNameStart(bytes[1])) {
+    TokenizeTag(ht, false);
+  } else if (available >= 3 && bytes[1] == '/' && IsTagNameStart(bytes[2])) {
+    TokenizeTag(ht, true);
+  } else if (available >= 3 && (bytes[1] == '!' || bytes[1] == '?' || bytes[1] == '/')) {
+    // doctypes, processing instructions and the like are dropped
+    TokenizeDelimited(ht, 2, ">", NULL);
+  } else {
+    Emit(handlers->text, bytes, 1, ht->auxData);
+    STAdvance(ht->st, 1);
+  }
+}
+
+void HTMLTokenize(streamtokenizer *st, const htmlhandlers *handlers, void *auxData)
+{
+  assert(st != NULL && handlers != NULL);
+
+  htmltokenizer ht = { st, handlers, auxData, kTagUnknown, 0 };
+  const char *bytes;
+  size_t available, minimum = 1;
+
+  while ((available = STPeek(st, minimum, &bytes)) > 0) {
+    bool exhausted = available < minimum;
+    minimum = 1;
+    if (bytes[0] == '<') {
+      TokenizeMarkup(&ht);
+      continue;
+    }
+
+    // text runs up to the next '<' or the end of what's been read so far
+    const char *open = memchr(bytes, '<', available);
+    size_t length = (open != NULL) ? (size_t) (open - bytes) : available;
+    if (open == NULL && !exhausted && !IsTagSpace(bytes[available - 1])) {
+      // the text may go on past the end of the window, so hold back whatever
+      // follows its last white space, to be reported along with the rest of its word
+      const char *p = bytes + available;
+      while (p > bytes && !IsTagSpace(p[-1])) p--;
+      if (p > bytes) {
+        length = p - bytes;
+        minimum = available - length + 1;
+      } else if (available < kLongestHeldText) {
+        minimum = available + 1;
+        continue;
+      }
+    }
+    Emit((ht.rawTag != kTagUnknown) ? handlers->rawText : handlers->text, bytes, length, auxData);
+    STAdvance(st, length);
+  }
+}
@@ -0,0 +1,110 @@
+#ifndef _htmltokenizer_
+#define _htmltokenizer_
+
+#include "bool.h"
+#include "streamtokenizer.h"
+
+/**
+ * File: html-tokenizer.h
+ * ----------------------
+ * Defines a single-pass, SAX-style tokenizer for HTML and for XML feeds
+ * such as RSS and Atom.  Rather than building a tree, HTMLTokenize walks
+ * the markup once, from start to finish, and reports what it finds by
+ * calling the client's functions: one for each start tag, attribute, end
+ * tag, run of text, comment and CDATA section.
+ *
+ * The input comes from a streamtokenizer, created with either STNew (over
+ * a FILE *) or STNewFromBuffer (over bytes already in memory); its
+ * delimiters are ignored.  Nothing is copied on the way to the client:
+ * every name, value and run of text is handed over as a pointer into the
+ * streamtokenizer's input and a length, and is *not* null-terminated.
+ * Over a buffer, the pointers address the client's own bytes; over a
+ * FILE *, they address the streamtokenizer's window and are only valid
+ * for the duration of the call.  Text and attribute values are passed
+ * exactly as written, with any entities (&amp; and the like) undecoded.
+ *
+ * The tokenizer follows the HTML5 rules closely enough for indexing:
+ *
+ *   - A '>' inside a quoted attribute value doesn't end the tag, and a
+ *     comment runs to the first "-->", whatever '>'s come before it.
+ *   - The contents of <script> and <style> are raw text: no tags are
+ *     recognized there except the matching end tag, and the contents are
+ *     reported through rawText instead of text.
+ *   - <![CDATA[ ... ]]> sections are recognized everywhere, as in XML.
+ *   - Doctypes, processing instructions ("<?xml ...?>") and other "<!"
+ *     declarations are skipped, and a '<' that can't begin a tag is text.
+ *   - Tag and attribute names are reported in their original case.
+ */
+
+/**
+ * Type: HTMLTagFunction
+ * ---------------------
+ * Class of function called for each start tag and each end tag with the
+ * tag's name and the client's auxData.  For a start tag, selfClosing is
+ * true if the tag ends in "/>"; it is always false for an end tag.  To
+ * act on particular tags, switch on ClassifyTag(name, nameLength) (see
+ * html-tags.h).
+ */
+
+typedef void (*HTMLTagFunction)(const char *name, int nameLength, bool selfClosing, void *auxData);
+
+/**
+ * Type: HTMLAttributeFunction
+ * ---------------------------
+ * Class of function called once for each attribute of a start tag, in
+ * order, right after the start tag itself has been reported.  An attribute
+ * written without a value (as in <option selected>) has a valueLength of 0.
+ * The quotes around a quoted value aren't included.
+ */
+
+typedef void (*HTMLAttributeFunction)(const char *name, int nameLength,
+                                      const char *value, int valueLength, void *auxData);
+
+/**
+ * Type: HTMLTextFunction
+ * ----------------------
+ * Class of function called with a run of characters: text, raw text,
+ * the contents of a comment (without the "<!--" and "-->") or of a CDATA
+ * section (without the "<![CDATA[" and "]]>").  Text and raw text may be
+ * delivered in pieces, so one run between two tags can arrive as several
+ * consecutive calls, but a run is only ever cut at white space (or at a
+ * stray '<'), so no word or entity is split between two pieces unless it
+ * runs on for thousands of characters without any.  Comments and CDATA
+ * sections always arrive whole.
+ */
+
+typedef void (*HTMLTextFunction)(const char *text, int length, void *auxData);
+
+/**
+ * Type: htmlhandlers
+ * ------------------
+ * The set of functions HTMLTokenize calls.  Any of them may be NULL, in
+ * which case the corresponding events are simply skipped.
+ */
+
+typedef struct {
+  HTMLTagFunction startTag;
+  HTMLAttributeFunction attribute;
+  HTMLTagFunction endTag;
+  HTMLTextFunction text;
+  HTMLTextFunction rawText;
+  HTMLTextFunction comment;
+  HTMLTextFunction cdata;
+} htmlhandlers;
+
+/**
+ * Function: HTMLTokenize
+ * Usage: htmlhandlers handlers = { PrintTag, NULL, NULL, CountWords };
+ *        HTMLTokenize(&st, &handlers, &counts);
+ * ----------------------
+ * Reads the remainder of the streamtokenizer's input as HTML or XML,
+ * calling the handlers' functions for everything it finds, in order, and
+ * passing auxData along to each of them.  The handlers mustn't call any
+ * streamtokenizer function on st.  A tag, comment or CDATA section left
+ * unterminated at the end of the input is dropped, except that an
+ * unterminated comment or CDATA section is still reported up to the end.
+ */
+
+void HTMLTokenize(streamtokenizer *st, const htmlhandlers *handlers, void *auxData);
+
+#endif
@@ -1,283 +1,19 @@
-#include <errno.h>
+#include <limits.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 #include "streamtokenizer.h"
 #include "html-utils.h"
+#include "html-entities.h"
+#include "html-tokenizer.h"
+#include "html-tags.h"
+#include "charset.h"
 #include <assert.h>
 
 #define UNICODE_MAX 0x10FFFFul
+#define REPLACEMENT_CHARACTER 0xFFFDul
 #define DEBUG_HTML 0
 
-int decode_html_entities_utf8(char *dest, const char *src);
-
-static const char *const NAMED_ENTITIES[][2] = {
-  { "AElig;", "Æ" },
-  { "Aacute;", "Á" },
-  { "Acirc;", "Â" },
-  { "Agrave;", "À" },
-  { "Alpha;", "Α" },
-  { "Aring;", "Å" },
-  { "Atilde;", "Ã" },
-  { "Auml;", "Ä" },
-  { "Beta;", "Β" },
-  { "Ccedil;", "Ç" },
-  { "Chi;", "Χ" },
-  { "Dagger;", "‡" },
-  { "Delta;", "Δ" },
-  { "ETH;", "Ð" },
-  { "Eacute;", "É" },
-  { "Ecirc;", "Ê" },
-  { "Egrave;", "È" },
-  { "Epsilon;", "Ε" },
-  { "Eta;", "Η" },
-  { "Euml;", "Ë" },
-  { "Gamma;", "Γ" },
-  { "Iacute;", "Í" },
-  { "Icirc;", "Î" },
-  { "Igrave;", "Ì" },
-  { "Iota;", "Ι" },
-  { "Iuml;", "Ï" },
-  { "Kappa;", "Κ" },
-  { "Lambda;", "Λ" },
-  { "Mu;", "Μ" },
-  { "Ntilde;", "Ñ" },
-  { "Nu;", "Ν" },
-  { "OElig;", "Œ" },
-  { "Oacute;", "Ó" },
-  { "Ocirc;", "Ô" },
-  { "Ograve;", "Ò" },
-  { "Omega;", "Ω" },
-  { "Omicron;", "Ο" },
-  { "Oslash;", "Ø" },
-  { "Otilde;", "Õ" },
-  { "Ouml;", "Ö" },
-  { "Phi;", "Φ" },
-  { "Pi;", "Π" },
-  { "Prime;", "″" },
-  { "Psi;", "Ψ" },
-  { "Rho;", "Ρ" },
-  { "Scaron;", "Š" },
-  { "Sigma;", "Σ" },
-  { "THORN;", "Þ" },
-  { "Tau;", "Τ" },
-  { "Theta;", "Θ" },
-  { "Uacute;", "Ú" },
-  { "Ucirc;", "Û" },
-  { "Ugrave;", "Ù" },
-  { "Upsilon;", "Υ" },
-  { "Uuml;", "Ü" },
-  { "Xi;", "Ξ" },
-  { "Yacute;", "Ý" },
-  { "Yuml;", "Ÿ" },
-  { "Zeta;", "Ζ" },
-  { "aacute;", "á" },
-  { "acirc;", "â" },
-  { "acute;", "´" },
-  { "aelig;", "æ" },
-  { "agrave;", "à" },
-  { "alefsym;", "ℵ" },
-  { "alpha;", "α" },
-  { "amp;", "&" },
-  { "and;", "∧" },
-  { "ang;", "∠" },
-  { "apos;", "'" },
-  { "aring;", "å" },
-  { "asymp;", "≈" },
-  { "atilde;", "ã" },
-  { "auml;", "ä" },
-  { "bdquo;", "„" },
-  { "beta;", "β" },
-  { "brvbar;", "¦" },
-  { "bull;", "•" },
-  { "cap;", "∩" },
-  { "ccedil;", "ç" },
-  { "cedil;", "¸" },
-  { "cent;", "¢" },
-  { "chi;", "χ" },
-  { "circ;", "ˆ" },
-  { "clubs;", "♣" },
-  { "cong;", "≅" },
-  { "copy;", "©" },
-  { "crarr;", "↵" },
-  { "cup;", "∪" },
-  { "curren;", "¤" },
-  { "dArr;", "⇓" },
-  { "dagger;", "†" },
-  { "darr;", "↓" },
-  { "deg;", "°" },
-  { "delta;", "δ" },
-  { "diams;", "♦" },
-  { "divide;", "÷" },
-  { "eacute;", "é" },
-  { "ecirc;", "ê" },
-  { "egrave;", "è" },
-  { "empty;", "∅" },
-  { "emsp;", "\xE2\x80\x83" },
-  { "ensp;", "\xE2\x80\x82" },
-  { "epsilon;", "ε" },
-  { "equiv;", "≡" },
-  { "eta;", "η" },
-  { "eth;", "ð" },
-  { "euml;", "ë" },
-  { "euro;", "€" },
-  { "exist;", "∃" },
-  { "fnof;", "ƒ" },
-  { "forall;", "∀" },
-  { "frac12;", "½" },
-  { "frac14;", "¼" },
-  { "frac34;", "¾" },
-  { "frasl;", "⁄" },
-  { "gamma;", "γ" },
-  { "ge;", "≥" },
-  { "gt;", ">" },
-  { "hArr;", "⇔" },
-  { "harr;", "↔" },
-  { "hearts;", "♥" },
-  { "hellip;", "…" },
-  { "iacute;", "í" },
-  { "icirc;", "î" },
-  { "iexcl;", "¡" },
-  { "igrave;", "ì" },
-  { "image;", "ℑ" },
-  { "infin;", "∞" },
-  { "int;", "∫" },
-  { "iota;", "ι" },
-  { "iquest;", "¿" },
-  { "isin;", "∈" },
-  { "iuml;", "ï" },
-  { "kappa;", "κ" },
-  { "lArr;", "⇐" },
-  { "lambda;", "λ" },
-  { "lang;", "〈" },
-  { "laquo;", "«" },
-  { "larr;", "←" },
-  { "lceil;", "⌈" },
-  { "ldquo;", "“" },
-  { "le;", "≤" },
-  { "lfloor;", "⌊" },
-  { "lowast;", "∗" },
-  { "loz;", "◊" },
-  { "lrm;", "\xE2\x80\x8E" },
-  { "lsaquo;", "‹" },
-  { "lsquo;", "‘" },
-  { "lt;", "<" },
-  { "macr;", "¯" },
-  { "mdash;", "—" },
-  { "micro;", "µ" },
-  { "middot;", "·" },
-  { "minus;", "−" },
-  { "mu;", "μ" },
-  { "nabla;", "∇" },
-  { "nbsp;", "\xC2\xA0" },
-  { "ndash;", "–" },
-  { "ne;", "≠" },
-  { "ni;", "∋" },
-  { "not;", "¬" },
-  { "notin;", "∉" },
-  { "nsub;", "⊄" },
-  { "ntilde;", "ñ" },
-  { "nu;", "ν" },
-  { "oacute;", "ó" },
-  { "ocirc;", "ô" },
-  { "oelig;", "œ" },
-  { "ograve;", "ò" },
-  { "oline;", "‾" },
-  { "omega;", "ω" },
-  { "omicron;", "ο" },
-  { "oplus;", "⊕" },
-  { "or;", "∨" },
-  { "ordf;", "ª" },
-  { "ordm;", "º" },
-  { "oslash;", "ø" },
-  { "otilde;", "õ" },
-  { "otimes;", "⊗" },
-  { "ouml;", "ö" },
-  { "para;", "¶" },
-  { "part;", "∂" },
-  { "permil;", "‰" },
-  { "perp;", "⊥" },
-  { "phi;", "φ" },
-  { "pi;", "π" },
-  { "piv;", "ϖ" },
-  { "plusmn;", "±" },
-  { "pound;", "£" },
-  { "prime;", "′" },
-  { "prod;", "∏" },
-  { "prop;", "∝" },
-  { "psi;", "ψ" },
-  { "quot;", "\"" },
-  { "rArr;", "⇒" },
-  { "radic;", "√" },
-  { "rang;", "〉" },
-  { "raquo;", "»" },
-  { "rarr;", "→" },
-  { "rceil;", "⌉" },
-  { "rdquo;", "”" },
-  { "real;", "ℜ" },
-  { "reg;", "®" },
-  { "rfloor;", "⌋" },
-  { "rho;", "ρ" },
-  { "rlm;", "\xE2\x80\x8F" },
-  { "rsaquo;", "›" },
-  { "rsquo;", "’" },
-  { "sbquo;", "‚" },
-  { "scaron;", "š" },
-  { "sdot;", "⋅" },
-  { "sect;", "§" },
-  { "shy;", "\xC2\xAD" },
-  { "sigma;", "σ" },
-  { "sigmaf;", "ς" },
-  { "sim;", "∼" },
-  { "spades;", "♠" },
-  { "sub;", "⊂" },
-  { "sube;", "⊆" },
-  { "sum;", "∑" },
-  { "sup1;", "¹" },
-  { "sup2;", "²" },
-  { "sup3;", "³" },
-  { "sup;", "⊃" },
-  { "supe;", "⊇" },
-  { "szlig;", "ß" },
-  { "tau;", "τ" },
-  { "there4;", "∴" },
-  { "theta;", "θ" },
-  { "thetasym;", "ϑ" },
-  { "thinsp;", "\xE2\x80\x89" },
-  { "thorn;", "þ" },
-  { "tilde;", "˜" },
-  { "times;", "×" },
-  { "trade;", "™" },
-  { "uArr;", "⇑" },
-  { "uacute;", "ú" },
-  { "uarr;", "↑" },
-  { "ucirc;", "û" },
-  { "ugrave;", "ù" },
-  { "uml;", "¨" },
-  { "upsih;", "ϒ" },
-  { "upsilon;", "υ" },
-  { "uuml;", "ü" },
-  { "weierp;", "℘" },
-  { "xi;", "ξ" },
-  { "yacute;", "ý" },
-  { "yen;", "¥" },
-  { "yuml;", "ÿ" },
-  { "zeta;", "ζ" },
-  { "zwj;", "\xE2\x80\x8D" },
-  { "zwnj;", "\xE2\x80\x8C" }
-};
-
-static int cmp(const void *key, const void *value)
-{
-  return strncmp((const char *)key, *(const char *const *)value, strlen(*(const char *const *)value));
-}
-
-static const char *get_named_entity(const char *name)
-{
-  const char *const *entity = (const char *const *)bsearch(name, NAMED_ENTITIES, sizeof NAMED_ENTITIES / sizeof *NAMED_ENTITIES, sizeof *NAMED_ENTITIES, cmp);
-
-  return entity ? entity[1] : NULL;
-}
-
 static size_t putc_utf8(unsigned long cp, char *buffer)
 {
   unsigned char *bytes = (unsigned char *)buffer;
@@ -315,126 +51,266 @@ static size_t putc_utf8(unsigned long cp, char *buffer)
   return 0;
 }
 
-static bool parse_entity(const char *current, char **to, const char **from)
+/**
+ * Function: DecodeEntity
+ * ----------------------
+ * Decodes the entity whose '&' sits at from, writing its UTF-8 form at *to
+ * and advancing *to past it.  Returns the number of characters the entity
+ * occupied in the source, or 0 (having written nothing) if from doesn't
+ * begin a well-formed numeric or named reference.  The whole entity is
+ * read before anything is written, so *to may trail from in the same
+ * buffer.  Expansions are never longer than their source with two
+ * exceptions, "&nGt;" and "&nLt;", and those are only decoded when earlier
+ * entities have left enough room between *to and from.
+ */
+
+static size_t DecodeEntity(const char *from, char **to)
 {
-  const char *end = strchr(current, ';');
-  if(!end) return 0;
+  const char *p = from + 1;
+
+  if (*p == '#') {
+    bool hex = (p[1] == 'x' || p[1] == 'X');
+    int base = hex ? 16 : 10;
+    p += hex ? 2 : 1;
+
+    const char *digits = p;
+    unsigned long cp = 0;
+    for (;; p++) {
+      int digit;
+      if (*p >= '0' && *p <= '9') digit = *p - '0';
+      else if (hex && (*p | 0x20) >= 'a' && (*p | 0x20) <= 'f') digit = (*p | 0x20) - 'a' + 10;
+      else break;
+      cp = cp * base + digit;
+      if (cp > UNICODE_MAX) cp = UNICODE_MAX + 1;   // out of range however many digits follow
+    }
+    if (p == digits || *p != ';') return 0;
 
-  if(current[1] == '#')
-  {
-    char *tail = NULL;
-    int errno_save = errno;
-    bool hex = current[2] == 'x' || current[2] == 'X';
+    // as in HTML5: what can't be a character becomes U+FFFD, and the C1
+    // controls are taken to be the Windows-1252 characters meant
+    if (cp == 0 || cp > UNICODE_MAX || (cp >= 0xD800 && cp <= 0xDFFF)) cp = REPLACEMENT_CHARACTER;
+    else if (cp >= 0x80 && cp <= 0x9F) cp = Windows1252CodePoint(cp);
 
-    errno = 0;
-    unsigned long cp = strtoul(
-    current + (hex ? 3 : 2), &tail, hex ? 16 : 10);
+    *to += putc_utf8(cp, *to);
+    return p + 1 - from;
+  }
 
-    bool fail = errno || tail != end || cp > UNICODE_MAX;
-    errno = errno_save;
-    if(fail) return 0;
+  int nameLength, valueLength;
+  const char *value = MatchHTMLEntity(p, &nameLength, &valueLength);
+  if (value == NULL) return 0;
 
-    *to += putc_utf8(cp, *to);
-    *from = end + 1;
+  size_t consumed = 1 + nameLength;
+  if (*to + valueLength > from + consumed) return 0;
 
-    return 1;
-  } else {
-    const char *entity = get_named_entity(&current[1]);
-    if(!entity) return 0;
+  memcpy(*to, value, valueLength);
+  *to += valueLength;
+  return consumed;
+}
 
-    size_t len = strlen(entity);
-    memcpy(*to, entity, len);
+void RemoveEscapeCharacters(char text[])
+{
+  assert(text != NULL);
 
-    *to += len;
-    *from = end + 1;
+  size_t length = strlen(text);
+  char *end = text + length;
 
-    return 1;
+  // nothing moves until the first entity, so text without any is left as is
+  char *from = memchr(text, '&', length);
+  char *to = from;
+
+  while (from != NULL && from < end) {
+    size_t consumed = DecodeEntity(from, &to);
+    if (consumed == 0) {
+      *to++ = *from;
+      consumed = 1;
+    }
+    from += consumed;
+
+    // copy the run up to the next '&' in one go
+    char *next = memchr(from, '&', end - from);
+    size_t run = (next != NULL ? next : end) - from;
+    if (to != from) memmove(to, from, run);
+    to += run;
+    from += run;
   }
+  if (to != NULL) *to = '\0';
+
+  if (DEBUG_HTML) printf("removingESC: converted text to %s\n", text);
 }
 
-int decode_html_entities_utf8(char *dest, const char *src)
+/**
+ * HTMLForEachWord runs HTMLTokenize and splits each piece of text it
+ * reports into words on the spot, with a second streamtokenizer pointed at
+ * the piece itself.  A piece is only copied (into the extractor's scratch
+ * buffer) if it has entities to decode.  Pieces are never cut mid-word or
+ * mid-entity, so each one can be handled on its own.
+ */
+
+typedef struct {
+  streamtokenizer words;
+  char *scratch;
+  size_t scratchSize;
+  const htmlhandlers *handlers;
+  STTokenFunction wordfn;
+  void *auxData;
+  int count;
+} wordextractor;
+
+static void ExtractWords(const char *text, int length, void *auxData)
 {
-  int result = 0;
+  wordextractor *we = auxData;
+
+  if (memchr(text, '&', length) != NULL) {
+    if ((size_t) length + 1 > we->scratchSize) {
+      while ((size_t) length + 1 > we->scratchSize)
+        we->scratchSize = (we->scratchSize == 0) ? 4096 : 2 * we->scratchSize;
+      we->scratch = realloc(we->scratch, we->scratchSize);
+      assert(we->scratch != NULL);
+    }
+    memcpy(we->scratch, text, length);
+    we->scratch[length] = '\0';
+    RemoveEscapeCharacters(we->scratch);
+    text = we->scratch;
+    length = strlen(we->scratch);
+  }
 
-  if(!src) src = dest;
+  STSetBuffer(&we->words, text, length);
+  we->count += STForEachWord(&we->words, we->wordfn, we->auxData);
+}
 
-  char *to = dest;
-  const char *from = src;
+static void ExtractCDATAWords(const char *text, int length, void *auxData)
+{
+  wordextractor *we = auxData;
+  streamtokenizer st;
 
-  for(const char *current; (current = strchr(from, '&'));)
-  {
-    memmove(to, from, (size_t)(current - from));
-    to += current - from;
+  STNewFromBuffer(&st, text, length, "<", false);
+  HTMLTokenize(&st, we->handlers, we);
+  STDispose(&st);
+}
+
+int HTMLForEachWord(streamtokenizer *st, STNormalizeFunction normalizefn, void *normalizeData,
+                    STTokenFunction wordfn, void *auxData)
+{
+  assert(st != NULL && wordfn != NULL);
+
+  // text gets split into words; raw text and comments are skipped
+  htmlhandlers handlers = { NULL, NULL, NULL, ExtractWords, NULL, NULL, ExtractCDATAWords };
+  wordextractor we;
+  we.scratch = NULL;
+  we.scratchSize = 0;
+  we.handlers = &handlers;
+  we.wordfn = wordfn;
+  we.auxData = auxData;
+  we.count = 0;
+
+  STNewFromBuffer(&we.words, NULL, 0, " ", true);
+  STSetNormalizer(&we.words, normalizefn, normalizeData);
+  HTMLTokenize(st, &handlers, &we);
+  STDispose(&we.words);
+  free(we.scratch);
+  return we.count;
+}
 
-    if(parse_entity(current, &to, &from))
-      continue;
+static const char kCDATAOpening[] = "<![CDATA[";
+static const char kCDATAClosing[] = "]]>";
+static const size_t kCDATAClosingLength = sizeof(kCDATAClosing) - 1;
 
-    from = current;
-    *to++ = *from++;
+// hands a piece of text to piecefn in chunks small enough to be counted in an int
+static void EmitPiece(STTokenFunction piecefn, const char *piece, size_t length, void *auxData)
+{
+  while (length > 0) {
+    int chunk = (length > INT_MAX) ? INT_MAX : (int) length;
+    piecefn(piece, chunk, auxData);
+    piece += chunk;
+    length -= chunk;
   }
+}
 
-  size_t remaining = strlen(from);
+bool ReadCDATA(streamtokenizer *st, STTokenFunction piecefn, void *auxData)
+{
+  assert(st != NULL && piecefn != NULL);
+
+  const char *bytes;
+  size_t available;
+
+  // each pass hands on what's been read so far, holding back a ']' or "]]" at
+  // the very end in case the rest of the "]]>" hasn't been read yet
+  while ((available = STPeek(st, kCDATAClosingLength, &bytes)) >= kCDATAClosingLength) {
+    const char *limit = bytes + available;
+    const char *p = bytes;
+    while ((p = memchr(p, ']', limit - p)) != NULL && (size_t) (limit - p) >= kCDATAClosingLength) {
+      if (p[1] == ']' && p[2] == '>') {
+        EmitPiece(piecefn, bytes, p - bytes, auxData);
+        STAdvance(st, p - bytes + kCDATAClosingLength);
+        return true;
+      }
+      p++;
+    }
+
+    size_t length = (p != NULL) ? (size_t) (p - bytes) : available;
+    EmitPiece(piecefn, bytes, length, auxData);
+    STAdvance(st, length);
+  }
 
-  memmove(to, from, remaining);
-  to += remaining;
-  *to = 0;
-  
-  result = (to - dest);
-  return result;
+  EmitPiece(piecefn, bytes, available, auxData);
+  STAdvance(st, available);
+  return false;
 }
 
-void RemoveEscapeCharacters(char text[])
+typedef struct {
+  char *buffer;
+  int bufferLength;
+  int length;
+} cdatabuffer;
+
+static void AppendCDATA(const char *piece, int length, void *auxData)
 {
-  assert(text != NULL);
+  cdatabuffer *cb = auxData;
+  int room = cb->bufferLength - 1 - cb->length;
+  if (length > room) length = room;
+  memcpy(cb->buffer + cb->length, piece, length);
+  cb->length += length;
+}
 
-  char *source = strdup(text);
-  char *dest = strdup(text);
- 
-  assert(source !=NULL);
-  assert(dest != NULL);
-
-  int length = decode_html_entities_utf8(dest, source);
-  
-  char *ptr = text; 
-  for (int i = 0; i < length; i++) {
-    ptr = (char *)ptr + i;
-    ptr = (char *)dest + i;
-  }
-  ptr = ptr + 1;
-  *ptr = '\0';
+// true, having consumed the rest of it, if the section's "]]>" begins with the buffer's last count characters
+static bool FinishesClosing(streamtokenizer *st, const char *text, int length, int count)
+{
+  const char *bytes;
+  size_t rest = kCDATAClosingLength - count;
 
-  if (DEBUG_HTML) printf("removingESC: converted text %s to %s\n",source,text);
-  
-  free(source);
-  free(dest);
+  if (length < count || strncmp(text + length - count, kCDATAClosing, count) != 0) return false;
+  if (STPeek(st, rest, &bytes) < rest || memcmp(bytes, kCDATAClosing + count, rest) != 0) return false;
+  STAdvance(st, rest);
+  return true;
 }
 
 bool extractCDATA(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength)
 {
-  char CDATAString[] = "<![CDATA[";
   assert(htmlBuffer != NULL);
   assert(htmlBufferLength >= 2);
 
-  // asume that stream is pointing to a <!CDATA[
-  
-  // copy the buffer to a temporary location
-  char *tempString = strdup(htmlBuffer);
-  assert(tempString != NULL);
-
-  char *startPos = strstr(htmlBuffer, CDATAString) + strlen(CDATAString);
-  char *endPos = strstr(htmlBuffer,"]");
-  int length = endPos - startPos;
-
-  if (DEBUG_HTML) printf("htmlBuffer length = %d\n",length);
+  char *start = strstr(htmlBuffer, kCDATAOpening);
+  if (start == NULL) return false;
+  start += strlen(kCDATAOpening);
 
-  char *strPtr;
-  strPtr = htmlBuffer;
-  for (int i = 0; i < length; i++)
-    htmlBuffer[i] = tempString[i + strlen(CDATAString)];
+  char *end = strstr(start, kCDATAClosing);
+  int length = (end != NULL) ? end - start : (int) strlen(start);
+  memmove(htmlBuffer, start, length);
 
-  htmlBuffer[length] = '\0'; 
-  free(tempString);
+  if (end == NULL && st != NULL) {
+    // the rest of the section is still on the stream, perhaps even part of the "]]>"
+    if (FinishesClosing(st, htmlBuffer, length, 2)) {
+      length -= 2;
+    } else if (FinishesClosing(st, htmlBuffer, length, 1)) {
+      length -= 1;
+    } else {
+      cdatabuffer cb = { htmlBuffer, htmlBufferLength, length };
+      ReadCDATA(st, AppendCDATA, &cb);
+      length = cb.length;
+    }
+  }
 
+  if (DEBUG_HTML) printf("htmlBuffer length = %d\n", length);
+  htmlBuffer[length] = '\0';
   return true;
 }
 
@@ -454,7 +330,7 @@ bool GetNextTag(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength)
     // place in the buffer all chars up to and including the > char
     int i = 0;
     while (!endTagFound && i < (htmlBufferLength - 1) ) {
-      next = fgetc(st->infile);
+      next = STNextChar(st);
 
       htmlBuffer[i++] = next;
 
@@ -475,6 +351,30 @@ bool GetNextTag(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength)
   }
 }
 
+htmltag GetTagType(const char htmlBuffer[], bool *isEndTag)
+{
+  assert(htmlBuffer != NULL);
+
+  const char *name = htmlBuffer;
+  if (*name == '<') name++;
+  bool endTag = *name == '/';
+  if (endTag) name++;
+  if (isEndTag != NULL) *isEndTag = endTag;
+
+  int length = strcspn(name, " \t\n\r\f/>");
+  return ClassifyTag(name, length);
+}
+
+// true if the token just read ends with the end tag of the given element
+static bool EndsWithEndTag(const char buffer[], htmltag tag)
+{
+  const char *name = TagName(tag);
+  size_t nameLength = strlen(name);
+  size_t length = strlen(buffer);
+  return length >= nameLength + 2 && buffer[length - nameLength - 2] == '<' &&
+    buffer[length - nameLength - 1] == '/' && strcasecmp(buffer + length - nameLength, name) == 0;
+}
+
 void SkipIrrelevantContent(streamtokenizer *st)
 {
   // need to read everything betweeen <aaa xxx bbb>
@@ -482,9 +382,8 @@ void SkipIrrelevantContent(streamtokenizer *st)
   char buffer[1024];
   int bufferLength = sizeof(buffer);
   bool foundToken = false;
-  int styleFound = 0;
   int commentFound = 0;
-  int scriptFound = 0;
+  int rawTextFound = 0;
 
   // look at all text up until the next > character 
   // we do not want to advance the stream just yet until we work out if irrelevant 
@@ -504,48 +403,31 @@ void SkipIrrelevantContent(streamtokenizer *st)
       while (!commentFound) {
  
         // now check if this ends in a -->
-        char *bufferPtr = (char *)buffer + strlen(buffer) - 2;
-        if (strncmp(bufferPtr,"--",2) == 0) {
+        size_t length = strlen(buffer);
+        if (length >= 2 && strncmp(buffer + length - 2, "--", 2) == 0) {
           commentFound = 1; 
-        } else {
-          // continue getting token up until next >
-          // advance the stream until we get the next > character
-          STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength,">");
+        } else if (!STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength, ">")) {
+          // continue getting token up until next >, unless the input has run out
+          return;
         }
       }
-    } 
-    if (strncmp(buffer, "script", 6) == 0) {
-      if (DEBUG_HTML) printf("found a script... now skip until find a </script>\n");
-      while (!scriptFound) {
-      
-        // now check if we find a closing </script>
-        STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength,">");
-      
-        if (strlen(buffer) > 7) {
-          char *bufferPtr = (char *)buffer + strlen(buffer) - 8;
-          if (strncmp(bufferPtr,"</script",8) == 0)
-            scriptFound = 1;
-        }
-      }
-    } 
-    if (strncmp(buffer, "style", 5) == 0) {
-      if (DEBUG_HTML) printf("found a style... now skip until find a </style>\n");
-      while (!styleFound) {
-      
-        // now check if we find a closing </style>
-        STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength,">");
-  
-        if (strlen(buffer) > 6) {
-          char *bufferPtr = (char *)buffer + strlen(buffer) - 7;
-          if (strncmp(bufferPtr, "</style", 7) == 0)
-            styleFound = 1;
-        }
-      }
-    }
-    if ((styleFound == 1 || scriptFound == 1 || commentFound == 1)) {
       return;
-    } else {
-      STSkipUntil(st, ">");
+    }
+
+    htmltag tag = GetTagType(buffer, NULL);
+    switch (tag) {
+      case kTagScript:
+      case kTagStyle:
+        // the contents are Javascript or CSS, so skip until we find the closing </script> or </style>
+        if (DEBUG_HTML) printf("found a %s... now skip until its end tag\n", TagName(tag));
+        while (!rawTextFound) {
+          if (!STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength, ">")) return;
+          rawTextFound = EndsWithEndTag(buffer, tag);
+        }
+        return;
+      default:
+        STSkipUntil(st, ">");
+        return;
     }
   }
 }
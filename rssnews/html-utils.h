@@ -3,6 +3,7 @@
 
 #include "bool.h"
 #include "streamtokenizer.h"
+#include "html-tags.h"
 #include <stddef.h>
 
 /**
@@ -12,7 +13,11 @@
  * and replaces all HTML escape sequences with their single
  * character equivalents.  Escape sequences always begin
  * with a '&' and typically end with a ';'.  Each substring
- * maps to a clearly defined character.
+ * maps to a clearly defined character.  As in HTML5, a numeric
+ * reference to something that can't be a character (0, a surrogate, or
+ * anything beyond U+10FFFF) becomes U+FFFD, and one to a C1 control
+ * (&#128; through &#159;) becomes the Windows-1252 character it meant,
+ * so the result is always valid UTF-8.
  *
  * Examples: "Sonny &amp; Cher" should really be "Sonny & Cher".
  *           "Zadie Smith&#39;s &quot;On Beauty&quot;" should really be "Zadie Smith's \"On Beauty\""
@@ -31,6 +36,23 @@ void RemoveEscapeCharacters(char text[]);
 
 bool GetNextTag(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength);
 
+/**
+ * Function: GetTagType
+ * Usage: if (GetNextTag(&st, tag, sizeof(tag))) {
+ *          bool isEndTag;
+ *          switch (GetTagType(tag, &isEndTag)) { case kTagTitle: ... }
+ *        }
+ * --------------------
+ * Identifies the tag in htmlBuffer, as filled in by GetNextTag (the
+ * leading '<' may also be missing), by way of ClassifyTag: returns the
+ * tag's htmltag, whatever the case of its name, or kTagUnknown if the
+ * name isn't a known one or the buffer holds a comment, doctype or the
+ * like.  If isEndTag isn't NULL, *isEndTag is set to true for an end tag
+ * such as "</title>" and to false otherwise.
+ */
+
+htmltag GetTagType(const char htmlBuffer[], bool *isEndTag);
+
 
 /**
  * Function: SkipIrrelevantContent
@@ -46,8 +68,8 @@ bool GetNextTag(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength);
  * the comment's end.
  *
  * It also skips potentially huge segments of content.  If
- * the HTML tag read right up front begins with "<script" or
- * with "<style", then we skip more than the tag; we actually
+ * the HTML tag read right up front is a <script> or a <style>
+ * (in any case), then we skip more than the tag; we actually
  * skip everything through the matching </script> or </style>.
  * Material sitting beneath the script and the style nodes 
  * within the HTML tree isn't text; it's either Javascript
@@ -57,6 +79,56 @@ bool GetNextTag(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength);
 
 void SkipIrrelevantContent(streamtokenizer *st);
 
+/**
+ * Function: HTMLForEachWord
+ * Usage: HTMLForEachWord(&st, NormalizeWord, NULL, IndexWord, &index);
+ * -------------------------
+ * Extracts the words of the text in the HTML read from the specified
+ * streamtokenizer in a single pass, doing everything that otherwise takes
+ * GetNextTag and SkipIrrelevantContent, RemoveEscapeCharacters and
+ * STNextToken in turn.  Tags, comments, doctypes and the contents of
+ * <script> and <style> are skipped (see HTMLTokenize), entities are
+ * decoded, and the text is split into case-folded words just as
+ * STForEachWord splits it.  CDATA sections, which in feeds usually wrap
+ * HTML, are treated as HTML themselves.  If normalizefn is non-NULL,
+ * each word is passed through it (along with normalizeData) as it would be
+ * if installed with STSetNormalizer.  Each surviving word is passed to
+ * wordfn, along with auxData, in the manner of STForEachWord.  Returns
+ * the number of words passed to wordfn.
+ */
+
+int HTMLForEachWord(streamtokenizer *st, STNormalizeFunction normalizefn, void *normalizeData,
+                    STTokenFunction wordfn, void *auxData);
+
+/**
+ * Function: ReadCDATA
+ * -------------------
+ * Reads the contents of a CDATA section straight off the specified
+ * streamtokenizer, which should be positioned just past the section's
+ * "<![CDATA[", and consumes everything through the "]]>" that closes it.
+ * The contents can be any length at all: they're handed to piecefn (along
+ * with auxData) directly from the streamtokenizer's input, in one or more
+ * consecutive pieces, without ever being copied or collected in one place.
+ * The "]]>" itself isn't reported.  Returns true if the section was
+ * properly closed, and false if the input ran out first.  Not available
+ * to a streamtokenizer created with STNewPush.
+ */
+
+bool ReadCDATA(streamtokenizer *st, STTokenFunction piecefn, void *auxData);
+
+/**
+ * Function: extractCDATA
+ * ----------------------
+ * Replaces the "<![CDATA[" ... "]]>" section within htmlBuffer with just
+ * its contents, moved to the front of the buffer and null-terminated.
+ * When the buffer holds only the start of the section (GetNextTag stops at
+ * the first '>', and CDATA often contains one), the rest of it is read
+ * from the specified streamtokenizer, through the closing "]]>", and
+ * appended.  Whatever doesn't fit in htmlBufferLength - 1 characters is
+ * consumed but dropped.  Returns false, and leaves the buffer alone, if
+ * there's no "<![CDATA[" in it.
+ */
+
 bool extractCDATA(streamtokenizer *st, char htmlBuffer[], int htmlBufferLength);
 
 #endif
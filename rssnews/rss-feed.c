@@ -0,0 +1,272 @@
+#include "rss-feed.h"
+#include "html-tokenizer.h"
+#include "html-tags.h"
+#include "html-utils.h"
+#include <string.h>
+#include <assert.h>
+
+/**
+ * The feed parser is a small state machine driven by HTMLTokenize's
+ * callbacks.  Between an item's start and end tags, the start tag of a
+ * recognized field element opens a capture, and every piece of text or
+ * CDATA up to the element's end tag widens the field's slice to cover it
+ * (CDATA pieces including their "<![CDATA[" and "]]>").  Because the feed
+ * is in memory, all the pointers HTMLTokenize hands over address the feed
+ * itself, so a slice is just the span from the first piece to the last.
+ */
+
+typedef enum { kNoField = -1, kTitle, kLink, kDescription, kContent, kPubDate, kGuid } feedfield;
+
+static const char kCDATAOpening[] = "<![CDATA[";
+static const int kCDATAOpeningLength = sizeof(kCDATAOpening) - 1;
+static const int kCDATAClosingLength = sizeof("]]>") - 1;
+
+typedef struct {
+  feeditem item;
+  tokenview content;          // <content> is only the description if nothing better turns up
+  bool inItem;
+  feedfield capturing;
+  const char *captureName;    // the element whose end tag closes the capture
+  int captureNameLength;
+  const char *start, *end;    // the span captured so far
+  bool inLink;                // between an Atom <link>'s start tag and its attributes' end
+  tokenview href;
+  bool alternate;
+  FeedItemFunction itemfn;
+  void *auxData;
+  int numItems;
+  const char *bodyEnd;        // just past the last byte of the feed
+} feedparser;
+
+static bool NameIs(const char *name, int length, const char *expected)
+{
+  return (size_t) length == strlen(expected) && memcmp(name, expected, length) == 0;
+}
+
+static feedfield FieldFor(htmltag tag)
+{
+  switch (tag) {
+    case kTagTitle: return kTitle;
+    case kTagLink: return kLink;
+    case kTagDescription: case kTagSummary: return kDescription;
+    case kTagContent: case kTagEncoded: return kContent;
+    case kTagPubDate: case kTagPublished: case kTagUpdated: case kTagDate: return kPubDate;
+    case kTagGuid: case kTagId: return kGuid;
+    default: return kNoField;
+  }
+}
+
+static tokenview *FieldView(feedparser *fp, feedfield field)
+{
+  switch (field) {
+    case kTitle: return &fp->item.title;
+    case kLink: return &fp->item.link;
+    case kDescription: return &fp->item.description;
+    case kContent: return &fp->content;
+    case kPubDate: return &fp->item.pubDate;
+    case kGuid: return &fp->item.guid;
+    default: return NULL;
+  }
+}
+
+static bool IsFeedSpace(char ch)
+{
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+static void SetView(tokenview *view, const char *start, const char *end)
+{
+  while (start < end && IsFeedSpace(*start)) start++;
+  while (end > start && IsFeedSpace(end[-1])) end--;
+  view->start = start;
+  view->length = end - start;
+}
+
+// an Atom <link>'s attributes are all in once any other event arrives
+static void FinishLink(feedparser *fp)
+{
+  if (!fp->inLink) return;
+  fp->inLink = false;
+  if (fp->href.length > 0 && fp->alternate && fp->item.link.length == 0) fp->item.link = fp->href;
+}
+
+static void WidenCapture(feedparser *fp, const char *start, const char *end)
+{
+  if (fp->start == NULL) fp->start = start;
+  fp->end = end;
+}
+
+static void StartItem(feedparser *fp)
+{
+  memset(&fp->item, 0, sizeof(fp->item));
+  memset(&fp->content, 0, sizeof(fp->content));
+  fp->inItem = true;
+  fp->capturing = kNoField;
+}
+
+static void FinishItem(feedparser *fp)
+{
+  if (fp->item.description.length == 0) fp->item.description = fp->content;
+  fp->inItem = false;
+  fp->numItems++;
+  fp->itemfn(&fp->item, fp->auxData);
+}
+
+static void OnStartTag(const char *name, int nameLength, bool selfClosing, void *auxData)
+{
+  feedparser *fp = auxData;
+  FinishLink(fp);
+  if (fp->capturing != kNoField) return;   // markup inside a field is part of the field
+
+  htmltag tag = ClassifyTag(name, nameLength);
+  if (tag == kTagItem || tag == kTagEntry) {
+    if (fp->inItem) FinishItem(fp);
+    StartItem(fp);
+    return;
+  }
+  if (!fp->inItem) return;
+
+  feedfield field = FieldFor(tag);
+  if (field == kNoField || FieldView(fp, field)->length > 0) return;
+  if (field == kLink) {
+    fp->inLink = true;
+    fp->href.length = 0;
+    fp->alternate = true;
+  }
+  if (selfClosing) return;
+
+  fp->capturing = field;
+  fp->captureName = name;
+  fp->captureNameLength = nameLength;
+  fp->start = fp->end = NULL;
+}
+
+static void OnAttribute(const char *name, int nameLength, const char *value, int valueLength,
+                        void *auxData)
+{
+  feedparser *fp = auxData;
+  if (!fp->inLink) return;
+
+  if (NameIs(name, nameLength, "href")) {
+    fp->href.start = value;
+    fp->href.length = valueLength;
+  } else if (NameIs(name, nameLength, "rel")) {
+    fp->alternate = NameIs(value, valueLength, "alternate");
+  }
+}
+
+static void OnEndTag(const char *name, int nameLength, bool selfClosing, void *auxData)
+{
+  (void) selfClosing;
+  feedparser *fp = auxData;
+  FinishLink(fp);
+
+  if (fp->capturing != kNoField) {
+    if (nameLength != fp->captureNameLength || memcmp(name, fp->captureName, nameLength) != 0) return;
+    if (fp->start != NULL) SetView(FieldView(fp, fp->capturing), fp->start, fp->end);
+    fp->capturing = kNoField;
+    return;
+  }
+
+  htmltag tag = ClassifyTag(name, nameLength);
+  if (fp->inItem && (tag == kTagItem || tag == kTagEntry)) FinishItem(fp);
+}
+
+static void OnText(const char *text, int length, void *auxData)
+{
+  feedparser *fp = auxData;
+  FinishLink(fp);
+  if (fp->capturing != kNoField) WidenCapture(fp, text, text + length);
+}
+
+static void OnCDATA(const char *text, int length, void *auxData)
+{
+  feedparser *fp = auxData;
+  FinishLink(fp);
+  if (fp->capturing == kNoField) return;
+
+  // a section left open at the end of the feed has no "]]>" to take in
+  const char *end = text + length;
+  if (fp->bodyEnd - end >= kCDATAClosingLength) end += kCDATAClosingLength;
+  WidenCapture(fp, text - kCDATAOpeningLength, end);
+}
+
+int FeedForEachItem(const char *body, size_t length, FeedItemFunction itemfn, void *auxData)
+{
+  assert(body != NULL || length == 0);
+  assert(itemfn != NULL);
+
+  feedparser fp;
+  memset(&fp, 0, sizeof(fp));
+  fp.capturing = kNoField;
+  fp.itemfn = itemfn;
+  fp.auxData = auxData;
+  fp.bodyEnd = body + length;
+
+  htmlhandlers handlers = { OnStartTag, OnAttribute, OnEndTag, OnText, OnText, NULL, OnCDATA };
+  streamtokenizer st;
+  STNewFromBuffer(&st, body, length, "<", false);
+  HTMLTokenize(&st, &handlers, &fp);
+  STDispose(&st);
+
+  FinishLink(&fp);
+  if (fp.inItem) {
+    if (fp.capturing != kNoField && fp.start != NULL)
+      SetView(FieldView(&fp, fp.capturing), fp.start, fp.end);
+    FinishItem(&fp);
+  }
+  return fp.numItems;
+}
+
+// returns the first occurrence of pattern within [p, end), or NULL
+static const char *FindSequence(const char *p, const char *end, const char *pattern, int patternLength)
+{
+  while (end - p >= patternLength) {
+    p = memchr(p, pattern[0], end - p - patternLength + 1);
+    if (p == NULL) return NULL;
+    if (memcmp(p, pattern, patternLength) == 0) return p;
+    p++;
+  }
+  return NULL;
+}
+
+// copies up to length characters of text into buffer at *used, leaving room for a '\0'
+static int Append(char buffer[], int bufferLength, int used, const char *text, int length)
+{
+  if (length > bufferLength - 1 - used) length = bufferLength - 1 - used;
+  memcpy(buffer + used, text, length);
+  return used + length;
+}
+
+int FeedDecodeField(const tokenview *field, char buffer[], int bufferLength)
+{
+  assert(field != NULL && buffer != NULL && bufferLength >= 1);
+
+  const char *p = field->start;
+  const char *end = p + field->length;
+  int used = 0;
+
+  while (p < end) {
+    const char *cdata = FindSequence(p, end, kCDATAOpening, kCDATAOpeningLength);
+    const char *textEnd = (cdata != NULL) ? cdata : end;
+
+    // plain text is copied, then decoded where it landed
+    if (textEnd > p) {
+      int from = used;
+      used = Append(buffer, bufferLength, used, p, textEnd - p);
+      buffer[used] = '\0';
+      RemoveEscapeCharacters(buffer + from);
+      used = from + strlen(buffer + from);
+    }
+    if (cdata == NULL) break;
+
+    const char *contents = cdata + kCDATAOpeningLength;
+    const char *close = FindSequence(contents, end, "]]>", kCDATAClosingLength);
+    if (close == NULL) close = end;
+    used = Append(buffer, bufferLength, used, contents, close - contents);
+    p = (close < end) ? close + kCDATAClosingLength : end;
+  }
+
+  buffer[used] = '\0';
+  return used;
+}
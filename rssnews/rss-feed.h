@@ -0,0 +1,82 @@
+#ifndef _rssfeed_
+#define _rssfeed_
+
+#include "bool.h"
+#include "streamtokenizer.h"
+#include <stddef.h>
+
+/**
+ * File: rss-feed.h
+ * ----------------
+ * Defines a parser that pulls the items out of an RSS (0.9x, 1.0 or 2.0)
+ * or Atom feed held in memory.  The feed is walked once, with HTMLTokenize,
+ * and each item is handed to the client as a set of slices of the feed
+ * itself: nothing is copied, and nothing is decoded, until the client asks
+ * for a particular field with FeedDecodeField.
+ */
+
+/**
+ * Type: feeditem
+ * --------------
+ * The fields of one item (an RSS <item> or an Atom <entry>).  Each is a
+ * tokenview addressing the field's raw contents within the feed, trimmed
+ * of surrounding white space but with any CDATA sections and entities
+ * left exactly as written; a field the item doesn't have has a length of
+ * 0.  The fields are drawn from these elements, the first one present
+ * winning where there's a choice:
+ *
+ *   title:        <title>
+ *   link:         <link>, or the href of Atom's <link rel="alternate">
+ *   description:  <description> or <summary>, else <content> or <content:encoded>
+ *   pubDate:      <pubDate>, <published>, <updated> or <dc:date>
+ *   guid:         <guid> or <id>
+ *
+ * Namespace prefixes and case are ignored, so <atom:title> counts as
+ * <title> (see ClassifyTag).
+ */
+
+typedef struct {
+  tokenview title;
+  tokenview link;
+  tokenview description;
+  tokenview pubDate;
+  tokenview guid;
+} feeditem;
+
+/**
+ * Type: FeedItemFunction
+ * ----------------------
+ * Class of function FeedForEachItem calls once per item, in document
+ * order, with the item and the client's auxData.  The slices remain valid
+ * for as long as the feed itself does, so the item can be copied and kept.
+ */
+
+typedef void (*FeedItemFunction)(const feeditem *item, void *auxData);
+
+/**
+ * Function: FeedForEachItem
+ * Usage: int numItems = FeedForEachItem(body, bodyLength, IndexItem, &index);
+ * -------------------------
+ * Parses the length bytes of feed at body and calls itemfn for each item
+ * found, returning the number of items.  An item still open when the feed
+ * ends is reported as it stands.
+ */
+
+int FeedForEachItem(const char *body, size_t length, FeedItemFunction itemfn, void *auxData);
+
+/**
+ * Function: FeedDecodeField
+ * Usage: FeedDecodeField(&item->title, title, sizeof(title));
+ * -------------------------
+ * Copies the field into buffer as a null-terminated string, decoding it
+ * along the way: the contents of CDATA sections are copied verbatim, and
+ * entities everywhere else are replaced with their UTF-8 expansions (see
+ * RemoveEscapeCharacters).  Fields hold text, so any markup in them (such
+ * as the HTML in a description) comes through as it stands.  Whatever
+ * doesn't fit in bufferLength - 1 characters is dropped.  Returns the
+ * length of the decoded string.
+ */
+
+int FeedDecodeField(const tokenview *field, char buffer[], int bufferLength);
+
+#endif
@@ -1,134 +1,1009 @@
 #include "streamtokenizer.h"
+#include "vector.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <assert.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
 
-#define DEBUG_STREAM 0 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ST_HAVE_SSSE3 1
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+#define DEBUG_STREAM 0
+
+/**
+ * A delimiterset records membership for all 256 character values in
+ * bits.  Because strchr matches the terminating '\0', a null character
+ * has always counted as a delimiter, and the bitmap preserves that.
+ *
+ * For sets made up entirely of ASCII characters, nibbles holds the same
+ * information arranged for a 16-byte table lookup: bit h of nibbles[l]
+ * is set if and only if the character (h << 4) | l is a delimiter.
+ */
+
+static void CompileDelimiters(delimiterset *set, const char *delimiters)
+{
+  memset(set, 0, sizeof(delimiterset));
+  set->ascii = true;
+
+  for (const unsigned char *d = (const unsigned char *) delimiters; ; d++) {
+    set->bits[*d >> 3] |= 1 << (*d & 7);
+    if (*d >= 0x80)
+      set->ascii = false;
+    else
+      set->nibbles[*d & 0x0F] |= 1 << (*d >> 4);
+    if (*d == '\0') break;
+  }
+}
+
+static bool InSet(const delimiterset *set, int ch)
+{
+  return (set->bits[(unsigned char) ch >> 3] >> (ch & 7)) & 1;
+}
+
+// uses the cached set when the client passes the streamtokenizer's own delimiters
+static const delimiterset *ResolveDelimiters(const streamtokenizer *st, const char *delimiters,
+                                             delimiterset *adhoc)
+{
+  if (delimiters == st->delimiters) return &st->delimiterSet;
+  CompileDelimiters(adhoc, delimiters);
+  return adhoc;
+}
+
+/**
+ * Returns the address of the first character in [p, limit) whose
+ * membership in the set is equal to member, or limit if there isn't one.
+ */
+
+static const char *ScalarFind(const delimiterset *set, const char *p, const char *limit, bool member)
+{
+  while (p < limit && InSet(set, (unsigned char) *p) != member) p++;
+  return p;
+}
+
+#ifdef ST_HAVE_SSSE3
+__attribute__((target("ssse3")))
+static const char *SSSE3Find(const delimiterset *set, const char *p, const char *limit, bool member)
+{
+  const __m128i table = _mm_loadu_si128((const __m128i *) set->nibbles);
+  const __m128i rowBits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i lowNibble = _mm_set1_epi8(0x0F);
+  const __m128i zero = _mm_setzero_si128();
+
+  while (limit - p >= 16) {
+    __m128i chars = _mm_loadu_si128((const __m128i *) p);
+    __m128i columns = _mm_shuffle_epi8(table, _mm_and_si128(chars, lowNibble));
+    __m128i rows = _mm_shuffle_epi8(rowBits, _mm_and_si128(_mm_srli_epi16(chars, 4), lowNibble));
+    int outside = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(columns, rows), zero));
+    int hits = member ? (~outside & 0xFFFF) : outside;
+    if (hits != 0) return p + __builtin_ctz(hits);
+    p += 16;
+  }
+  return ScalarFind(set, p, limit, member);
+}
+
+static bool HaveSSSE3(void)
+{
+  static int supported = -1;
+  if (supported < 0) supported = __builtin_cpu_supports("ssse3") ? 1 : 0;
+  return supported;
+}
+#endif
+
+static const char *FindInBuffer(const delimiterset *set, const char *p, const char *limit, bool member)
+{
+#ifdef ST_HAVE_SSSE3
+  if (set->ascii && HaveSSSE3()) return SSSE3Find(set, p, limit, member);
+#endif
+  return ScalarFind(set, p, limit, member);
+}
+
+// size of the first window allocated over a stream; it doubles whenever a token outgrows it
+static const size_t kInitialWindowSize = 64 * 1024;
 
 void STNew(streamtokenizer *st, FILE *infile, const char *delimiters, bool discardDelimiters)
 {
   assert(infile != NULL);
   assert(delimiters != NULL);
   assert(strlen(delimiters) > 0);
-  
+
   st->infile = infile;
   st->discardDelimiters = discardDelimiters;
   st->delimiters = strdup(delimiters);
+  CompileDelimiters(&st->delimiterSet, st->delimiters);
+  st->cursor = NULL;
+  st->limit = NULL;
+  st->window = NULL;
+  st->windowSize = 0;
+  st->atEOF = false;
+  st->word = NULL;
+  st->wordSize = 0;
+  st->normalizefn = NULL;
+  st->normalizeData = NULL;
+  st->tokenfn = NULL;
+  st->auxData = NULL;
+}
+
+void STNewFromBuffer(streamtokenizer *st, const char *bytes, size_t length,
+                     const char *delimiters, bool discardDelimiters)
+{
+  assert(bytes != NULL || length == 0);
+  assert(delimiters != NULL);
+  assert(strlen(delimiters) > 0);
+
+  st->infile = NULL;
+  st->discardDelimiters = discardDelimiters;
+  st->delimiters = strdup(delimiters);
+  CompileDelimiters(&st->delimiterSet, st->delimiters);
+  st->cursor = bytes;
+  st->limit = bytes + length;
+  st->window = NULL;
+  st->windowSize = 0;
+  st->atEOF = true;
+  st->word = NULL;
+  st->wordSize = 0;
+  st->normalizefn = NULL;
+  st->normalizeData = NULL;
+  st->tokenfn = NULL;
+  st->auxData = NULL;
+}
+
+void STSetBuffer(streamtokenizer *st, const char *bytes, size_t length)
+{
+  assert(st->infile == NULL && st->tokenfn == NULL);
+  assert(bytes != NULL || length == 0);
+
+  st->cursor = bytes;
+  st->limit = bytes + length;
+}
+
+void STNewPush(streamtokenizer *st, const char *delimiters, bool discardDelimiters,
+               STTokenFunction tokenfn, void *auxData)
+{
+  assert(tokenfn != NULL);
+
+  STNewFromBuffer(st, NULL, 0, delimiters, discardDelimiters);
+  st->tokenfn = tokenfn;
+  st->auxData = auxData;
 }
 
 void STDispose(streamtokenizer *st)
 {
   free((void *) st->delimiters);  // donates the memory allocated by strdup back to the heap
+  free(st->window);
+  free(st->word);
+}
+
+/**
+ * Over a stream, cursor through limit is the unread part of a window owned
+ * by the streamtokenizer, and STRefill appends more of the stream to it.
+ * The unread characters are first slid to the front of the window (which
+ * is doubled if they already fill it), so everything from the cursor
+ * onward survives a refill, but at a new address: callers scanning ahead
+ * of the cursor must hold on to offsets rather than pointers.
+ *
+ * Returns true if any characters were added, and false once the stream is
+ * exhausted (or always, for a streamtokenizer over a buffer).
+ */
+
+static bool STRefill(streamtokenizer *st)
+{
+  if (st->atEOF) return false;
+
+  size_t pending = st->limit - st->cursor;
+  if (pending == st->windowSize) {
+    size_t offset = st->cursor - st->window;
+    st->windowSize = (st->windowSize == 0) ? kInitialWindowSize : 2 * st->windowSize;
+    st->window = realloc(st->window, st->windowSize);
+    assert(st->window != NULL);
+    st->cursor = st->window + offset;
+  }
+
+  if (pending > 0) memmove(st->window, st->cursor, pending);
+  st->cursor = st->window;
+  st->limit = st->window + pending;
+
+  size_t numRead = fread(st->window + pending, 1, st->windowSize - pending, st->infile);
+  st->limit += numRead;
+  if (numRead == 0) st->atEOF = true;
+  return numRead > 0;
+}
+
+/**
+ * Returns the offset from the cursor of the first character, at or beyond
+ * offset from, whose membership in the set is equal to member, or the
+ * number of characters left if there isn't one.  The window is refilled
+ * as needed, so the answer is never cut short by the end of the window.
+ */
+
+static size_t STScan(streamtokenizer *st, const delimiterset *set, size_t from, bool member)
+{
+  while (true) {
+    const char *found = FindInBuffer(set, st->cursor + from, st->limit, member);
+    from = found - st->cursor;
+    if (found < st->limit || !STRefill(st)) return from;
+  }
+}
+
+/**
+ * Measures the token at the cursor without consuming it: a lone delimiter,
+ * or else the run of non-delimiters up to the next delimiter (or the end
+ * of the input), but no longer than maxLength.  Returns false if there
+ * are no characters left.
+ */
+
+static bool STMeasureToken(streamtokenizer *st, const delimiterset *set, size_t maxLength,
+                           size_t *length)
+{
+  if (st->cursor == st->limit && !STRefill(st)) return false;
+
+  if (InSet(set, (unsigned char) *st->cursor)) {
+    *length = 1;
+    return true;
+  }
+
+  size_t from = 1;
+  while (true) {
+    // scan at most the window, so a huge token doesn't grow it past maxLength
+    const char *stop = ((size_t) (st->limit - st->cursor) > maxLength) ? st->cursor + maxLength : st->limit;
+    const char *found = FindInBuffer(set, st->cursor + from, stop, true);
+    from = found - st->cursor;
+    if (found < st->limit || from == maxLength || !STRefill(st)) break;
+  }
+
+  *length = from;
+  return true;
+}
+
+static int STGetChar(streamtokenizer *st)
+{
+  if (st->cursor == st->limit && !STRefill(st)) return EOF;
+  return (unsigned char) *st->cursor++;
+}
+
+int STNextChar(streamtokenizer *st)
+{
+  return STGetChar(st);
+}
+
+// applies the normalizer, if there is one, to the null-terminated token
+static bool STNormalize(const streamtokenizer *st, char *token, int *length)
+{
+  return st->normalizefn == NULL || st->normalizefn(token, length, st->normalizeData);
 }
 
 bool STNextToken(streamtokenizer *st, char buffer[], int bufferLength)
 {
-	return STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength, st->delimiters);
+  int length;
+
+  do {
+    if (!STNextTokenUsingDifferentDelimiters(st, buffer, bufferLength, st->delimiters)) return false;
+    length = strlen(buffer);
+  } while (!STNormalize(st, buffer, &length));
+
+  buffer[length] = '\0';
+  return true;
+}
+
+static bool STNextTokenHelper(streamtokenizer *st, const delimiterset *set, size_t maxLength,
+                              tokenview *token)
+{
+  size_t length;
+
+  if (st->discardDelimiters) st->cursor += STScan(st, set, 0, false);
+  if (!STMeasureToken(st, set, maxLength, &length)) return false;
+
+  token->start = st->cursor;
+  token->length = length;
+  st->cursor += length;
+  return true;
 }
 
 bool STNextTokenUsingDifferentDelimiters(streamtokenizer *st, char buffer[], int bufferLength, const char *delimiters)
 {
-  int i;
-  int next;
-  
+  delimiterset adhoc;
+  tokenview token;
+
   assert(buffer != NULL);
   assert(bufferLength >= 2);
-  
-  if (st->discardDelimiters) STSkipOver(st, delimiters);
-  next = getc(st->infile);
-  if (next == EOF) return false;
-  buffer[0] = next;
-  if (strchr(delimiters, next) != NULL) {
-    buffer[1] = '\0';
+
+  // long tokens are chopped to what fits, leaving the rest for the next call
+  const delimiterset *set = ResolveDelimiters(st, delimiters, &adhoc);
+  if (!STNextTokenHelper(st, set, bufferLength - 1, &token)) return false;
+
+  memcpy(buffer, token.start, token.length);
+  buffer[token.length] = '\0';
+  return true;
+}
+
+bool STNextTokenView(streamtokenizer *st, tokenview *token)
+{
+  return STNextTokenViewUsingDifferentDelimiters(st, token, st->delimiters);
+}
+
+bool STNextTokenViewUsingDifferentDelimiters(streamtokenizer *st, tokenview *token,
+                                             const char *delimiters)
+{
+  delimiterset adhoc;
+
+  assert(token != NULL);
+  assert(delimiters != NULL);
+
+  const delimiterset *set = ResolveDelimiters(st, delimiters, &adhoc);
+  return STNextTokenHelper(st, set, SIZE_MAX, token);
+}
+
+/**
+ * Finds the next token, starting at cursor, provided it lies entirely
+ * within the window, in which case start and end bracket it.  Returns
+ * false, with start marking where the search left off, if the window runs
+ * out first; the rest of that token (if there is one) isn't read yet.
+ */
+
+static bool NextTokenInWindow(const streamtokenizer *st, const char *cursor,
+                              const char **start, const char **end)
+{
+  const delimiterset *set = &st->delimiterSet;
+
+  if (st->discardDelimiters) cursor = FindInBuffer(set, cursor, st->limit, false);
+  *start = cursor;
+  if (cursor == st->limit) return false;
+
+  if (InSet(set, (unsigned char) *cursor)) {
+    *end = cursor + 1;
     return true;
   }
-  
-  // pull characters until hit stop character, or until buffer is full
-  for (i = 1; i < bufferLength - 1; i++) { // leave room for '\0'
-    next = fgetc(st->infile);
-    if (next == EOF) break;
-    if (strchr(delimiters, next) != NULL) {
-      ungetc(next, st->infile);
+
+  *end = FindInBuffer(set, cursor + 1, st->limit, true);
+  return *end < st->limit || st->atEOF;
+}
+
+static void STReserveWord(streamtokenizer *st, size_t needed);
+
+/**
+ * Passes a token to tokenfn, by way of the normalizer if there is one.
+ * The input mustn't be written to, so a token to be normalized is copied
+ * into st->word first.  Returns false if the normalizer rejected it.
+ */
+
+static bool STEmitToken(streamtokenizer *st, const char *token, int length,
+                        STTokenFunction tokenfn, void *auxData)
+{
+  if (st->normalizefn != NULL) {
+    STReserveWord(st, length + 1);
+    memcpy(st->word, token, length);
+    st->word[length] = '\0';
+    if (!STNormalize(st, st->word, &length)) return false;
+    token = st->word;
+  }
+
+  tokenfn(token, length, auxData);
+  return true;
+}
+
+int STForEachToken(streamtokenizer *st, STTokenFunction tokenfn, void *auxData)
+{
+  const char *start, *end;
+  tokenview token;
+  int count = 0;
+
+  assert(tokenfn != NULL);
+
+  while (true) {
+    while (NextTokenInWindow(st, st->cursor, &start, &end)) {
+      st->cursor = end;
+      if (STEmitToken(st, start, end - start, tokenfn, auxData)) count++;
+    }
+
+    // the next token runs off the end of the window, so refill and take it the slow way
+    st->cursor = start;
+    if (!STNextTokenHelper(st, &st->delimiterSet, SIZE_MAX, &token)) return count;
+    if (STEmitToken(st, token.start, token.length, tokenfn, auxData)) count++;
+  }
+}
+
+int STNextTokens(streamtokenizer *st, tokenview tokens[], int maxTokens)
+{
+  const char *start, *end;
+  int count = 0;
+
+  assert(tokens != NULL);
+  assert(maxTokens > 0);
+
+  while (count < maxTokens) {
+    if (!NextTokenInWindow(st, st->cursor, &start, &end)) {
+      // a refill would move the tokens already handed back, so only refill for the first one
+      st->cursor = start;
+      if (count == 0 && STNextTokenHelper(st, &st->delimiterSet, SIZE_MAX, &tokens[0])) count++;
       break;
     }
-    
-    buffer[i] = next; 
+
+    tokens[count].start = start;
+    tokens[count].length = end - start;
+    st->cursor = end;
+    count++;
   }
-  
-  // i indexes place where null-term should be placed...
-  buffer[i] = '\0';
-  return true;
+
+  return count;
+}
+
+/**
+ * Between calls to STFeed, the window holds the start of a token that ran
+ * off the end of the last chunk (if one did), and cursor and limit bracket
+ * it.  During a call, cursor and limit are pointed at the new chunk itself
+ * so that it can be tokenized in place; only the unfinished token at its
+ * end is copied into the window.
+ */
+
+static void STSetCarry(streamtokenizer *st, const char *bytes, size_t length, size_t offset)
+{
+  if (offset + length > st->windowSize) {
+    while (offset + length > st->windowSize)
+      st->windowSize = (st->windowSize == 0) ? 64 : 2 * st->windowSize;
+    st->window = realloc(st->window, st->windowSize);
+    assert(st->window != NULL);
+  }
+
+  if (length > 0) memcpy(st->window + offset, bytes, length);
+  st->cursor = st->window;
+  st->limit = st->window + offset + length;
+}
+
+int STFeed(streamtokenizer *st, const char *bytes, size_t length)
+{
+  const char *start, *end;
+  int count = 0;
+
+  assert(st->tokenfn != NULL);
+  assert(bytes != NULL || length == 0);
+
+  const char *chunkEnd = bytes + length;
+  size_t carryLength = st->limit - st->cursor;
+  if (carryLength > 0) {
+    // finish the carried token first; it can only be a run of non-delimiters
+    const char *stop = FindInBuffer(&st->delimiterSet, bytes, chunkEnd, true);
+    STSetCarry(st, bytes, stop - bytes, carryLength);
+    if (stop == chunkEnd) return 0;
+
+    st->tokenfn(st->window, st->limit - st->window, st->auxData);
+    count++;
+    bytes = stop;
+  }
+
+  st->cursor = bytes;
+  st->limit = chunkEnd;
+  st->atEOF = false;
+  while (NextTokenInWindow(st, st->cursor, &start, &end)) {
+    st->cursor = end;
+    st->tokenfn(start, end - start, st->auxData);
+    count++;
+  }
+
+  st->atEOF = true;
+  STSetCarry(st, start, chunkEnd - start, 0);
+  return count;
+}
+
+int STFinish(streamtokenizer *st)
+{
+  assert(st->tokenfn != NULL);
+
+  size_t carryLength = st->limit - st->cursor;
+  st->limit = st->cursor;
+  if (carryLength == 0) return 0;
+
+  st->tokenfn(st->cursor, carryLength, st->auxData);
+  return 1;
 }
 
 bool STLookAtNextToken(streamtokenizer *st, char buffer[], int bufferLength, const char *delimiters)
-{ 
-  int i = 0;
-  int next;
-  
+{
+  delimiterset adhoc;
+  size_t length;
+
   assert(buffer != NULL);
   assert(bufferLength >= 2);
 
-  int streamPtr = ftell(st->infile);
+  // peeking never moves the cursor, so there's nothing to unwind
+  const delimiterset *set = ResolveDelimiters(st, delimiters, &adhoc);
+  if (!STMeasureToken(st, set, bufferLength - 1, &length)) return false;
 
-  next = getc(st->infile);
-  if (next == EOF) return false;
-  buffer[0] = next;
-  if (strchr(delimiters, next) != NULL) {
-    buffer[1] = '\0';
-    return true;
+  // also include the delimiter that stopped the token, if there's one and it fits
+  if (length < (size_t) bufferLength - 1 && !InSet(set, (unsigned char) *st->cursor)) {
+    if (st->cursor + length < st->limit || STRefill(st)) length++;
   }
- 
-  // pull characters until hit stop character, or until buffer is full
-  for (i = 1; i < bufferLength - 1; i++) { // leave room for '\0'
-    next = fgetc(st->infile);
-    if (next == EOF) break;
-    if (strchr(delimiters, next) != NULL) {
+
+  memcpy(buffer, st->cursor, length);
+  buffer[length] = '\0';
+  return true;
+}
+
+static int STSkipHelper(streamtokenizer *st, const delimiterset *set, bool skipping)
+{
+  // skipping stops at the first character outside the set, and vice versa
+  st->cursor += STScan(st, set, 0, !skipping);
+  return (st->cursor < st->limit) ? (unsigned char) *st->cursor : EOF;
+}
+
+int STSkipUntil(streamtokenizer *st, const char *skipUntilSet)
+{
+  delimiterset adhoc;
+  return STSkipHelper(st, ResolveDelimiters(st, skipUntilSet, &adhoc), false);
+}
+
+int STSkipOver(streamtokenizer *st, const char *skipSet)
+{
+  delimiterset adhoc;
+  return STSkipHelper(st, ResolveDelimiters(st, skipSet, &adhoc), true);
+}
+
+size_t STPeek(streamtokenizer *st, size_t minimum, const char **bytes)
+{
+  assert(st->tokenfn == NULL);
+  while ((size_t) (st->limit - st->cursor) < minimum && STRefill(st)) ;
+  *bytes = st->cursor;
+  return st->limit - st->cursor;
+}
+
+void STAdvance(streamtokenizer *st, size_t count)
+{
+  assert(count <= (size_t) (st->limit - st->cursor));
+  st->cursor += count;
+}
+
+/**
+ * Word mode ignores the delimiter set and splits UTF-8 text into words
+ * instead.  ASCII letters and digits are word characters, and so is every
+ * other code point except those in the table below, which lists the
+ * punctuation, spacing and symbol ranges (and C1 controls, surrogates,
+ * private use and noncharacters) that ought to separate words.  It's a
+ * deliberate approximation of Unicode's word boundary rules that needs no
+ * property tables, but it catches everything that commonly leaks out of web
+ * pages: nonbreaking spaces, curly quotes, dashes, ellipses, bullets and
+ * the like.  Invalid UTF-8 is treated as a separator, a byte at a time.
+ */
+
+static const int kSeparatorRanges[][2] = {
+  {0x0080, 0x00A9}, {0x00AB, 0x00B4}, {0x00B6, 0x00B9}, {0x00BB, 0x00BF},
+  {0x00D7, 0x00D7}, {0x00F7, 0x00F7}, {0x037E, 0x037E}, {0x0387, 0x0387},
+  {0x055A, 0x055F}, {0x0589, 0x058A}, {0x05BE, 0x05BE}, {0x05C0, 0x05C0},
+  {0x05C3, 0x05C3}, {0x05C6, 0x05C6}, {0x05F3, 0x05F4}, {0x0600, 0x060F},
+  {0x061B, 0x061F}, {0x066A, 0x066D}, {0x06D4, 0x06D4}, {0x0964, 0x0965},
+  {0x0970, 0x0970}, {0x0E4F, 0x0E4F}, {0x0E5A, 0x0E5B}, {0x10FB, 0x10FB},
+  {0x1360, 0x1368}, {0x166D, 0x166E}, {0x1680, 0x1680}, {0x16EB, 0x16ED},
+  {0x180E, 0x180E}, {0x2000, 0x2BFF}, {0x2E00, 0x2E7F}, {0x3000, 0x3003},
+  {0x3008, 0x3020}, {0x3030, 0x3030}, {0x303D, 0x303D}, {0x30FB, 0x30FB},
+  {0xD800, 0xF8FF}, {0xFD3E, 0xFD3F}, {0xFE10, 0xFE19}, {0xFE30, 0xFE6B},
+  {0xFEFF, 0xFEFF}, {0xFF01, 0xFF0F}, {0xFF1A, 0xFF20}, {0xFF3B, 0xFF40},
+  {0xFF5B, 0xFF65}, {0xFFF0, 0xFFFF}, {0x1F000, 0x1FAFF}, {0xE0000, 0x10FFFF}
+};
+
+static const int kRightSingleQuotationMark = 0x2019;
+
+static bool IsWordCodePoint(int cp)
+{
+  if (cp < 0) return false;
+  if (cp < 0x80) return isalnum(cp);
+
+  int low = 0, high = sizeof(kSeparatorRanges) / sizeof(kSeparatorRanges[0]) - 1;
+  while (low <= high) {
+    int mid = (low + high) / 2;
+    if (cp < kSeparatorRanges[mid][0])
+      high = mid - 1;
+    else if (cp > kSeparatorRanges[mid][1])
+      low = mid + 1;
+    else
+      return false;
+  }
+  return true;
+}
+
+/**
+ * Simple (one-to-one) case folding for ASCII, Latin-1, Latin Extended-A,
+ * Greek and Cyrillic.  Code points outside those blocks come back unchanged.
+ */
+
+static int FoldCodePoint(int cp)
+{
+  if (cp < 0x80) return (cp >= 'A' && cp <= 'Z') ? cp + 0x20 : cp;
+  if (cp < 0x100) return (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) ? cp + 0x20 : cp;
+
+  if (cp < 0x180) {
+    if (cp == 0x178) return 0xFF;
+    if (cp == 0x17F) return 's';
+    if ((cp <= 0x12F || (cp >= 0x132 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) && cp % 2 == 0)
+      return cp + 1;
+    if (((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) && cp % 2 == 1)
+      return cp + 1;
+    return cp;
+  }
+
+  if (cp >= 0x370 && cp < 0x400) {
+    if ((cp >= 0x391 && cp <= 0x3A1) || (cp >= 0x3A3 && cp <= 0x3AB)) return cp + 0x20;
+    if (cp == 0x386) return 0x3AC;
+    if (cp >= 0x388 && cp <= 0x38A) return cp + 0x25;
+    if (cp == 0x38C) return 0x3CC;
+    if (cp == 0x38E || cp == 0x38F) return cp + 0x3F;
+    if (cp == 0x3C2) return 0x3C3;  // final sigma folds to sigma
+    return cp;
+  }
+
+  if (cp >= 0x400 && cp < 0x530) {
+    if (cp < 0x410) return cp + 0x50;
+    if (cp < 0x430) return cp + 0x20;
+    if (cp == 0x4C0) return 0x4CF;
+    if (cp >= 0x4C1 && cp <= 0x4CE) return (cp % 2 == 1) ? cp + 1 : cp;
+    if ((cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF) || cp >= 0x4D0)
+      return (cp % 2 == 0) ? cp + 1 : cp;
+  }
+
+  return cp;
+}
+
+/**
+ * Decodes the UTF-8 sequence at p, which has available bytes before limit.
+ * Returns its length and sets *cp, or, if the sequence is invalid (overlong,
+ * a surrogate, out of range, or cut short), returns 1 and sets *cp to -1.
+ */
+
+static int DecodeUTF8(const unsigned char *p, const unsigned char *limit, int *cp)
+{
+  int length;
+  unsigned char low = 0x80, high = 0xBF;
+
+  if (p[0] < 0x80) {
+    *cp = p[0];
+    return 1;
+  }
+
+  if (p[0] >= 0xC2 && p[0] <= 0xDF) {
+    length = 2;
+    *cp = p[0] & 0x1F;
+  } else if (p[0] >= 0xE0 && p[0] <= 0xEF) {
+    length = 3;
+    *cp = p[0] & 0x0F;
+    if (p[0] == 0xE0) low = 0xA0;
+    if (p[0] == 0xED) high = 0x9F;
+  } else if (p[0] >= 0xF0 && p[0] <= 0xF4) {
+    length = 4;
+    *cp = p[0] & 0x07;
+    if (p[0] == 0xF0) low = 0x90;
+    if (p[0] == 0xF4) high = 0x8F;
+  } else {
+    *cp = -1;
+    return 1;
+  }
+
+  if (limit - p < length || p[1] < low || p[1] > high) {
+    *cp = -1;
+    return 1;
+  }
+
+  for (int i = 1; i < length; i++) {
+    if ((p[i] & 0xC0) != 0x80) {
+      *cp = -1;
+      return 1;
+    }
+    *cp = (*cp << 6) | (p[i] & 0x3F);
+  }
+
+  return length;
+}
+
+static int EncodeUTF8(int cp, char *out)
+{
+  if (cp < 0x80) {
+    out[0] = cp;
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = 0xC0 | (cp >> 6);
+    out[1] = 0x80 | (cp & 0x3F);
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = 0xE0 | (cp >> 12);
+    out[1] = 0x80 | ((cp >> 6) & 0x3F);
+    out[2] = 0x80 | (cp & 0x3F);
+    return 3;
+  }
+  out[0] = 0xF0 | (cp >> 18);
+  out[1] = 0x80 | ((cp >> 12) & 0x3F);
+  out[2] = 0x80 | ((cp >> 6) & 0x3F);
+  out[3] = 0x80 | (cp & 0x3F);
+  return 4;
+}
+
+/**
+ * Returns the length of the run of characters at p (up to limit) that
+ * are ASCII letters and digits, if inWord is true, or that are ASCII but
+ * not letters or digits, if inWord is false.  On x86-64 the bytes are
+ * classified 16 at a time with SSE2; bytes of 0x80 and up fail both tests,
+ * and only those ever need to be decoded.
+ */
+
+static size_t AsciiRun(const char *p, const char *limit, bool inWord)
+{
+  const char *start = p;
+
+#ifdef ST_HAVE_SSSE3
+  const __m128i beforeDigits = _mm_set1_epi8('0' - 1), afterDigits = _mm_set1_epi8('9' + 1);
+  const __m128i beforeLetters = _mm_set1_epi8('a' - 1), afterLetters = _mm_set1_epi8('z' + 1);
+  const __m128i caseBit = _mm_set1_epi8(0x20);
+
+  while (limit - p >= 16) {
+    // signed comparisons, so bytes of 0x80 and up (negative) are never letters or digits
+    __m128i chars = _mm_loadu_si128((const __m128i *) p);
+    __m128i lowered = _mm_or_si128(chars, caseBit);
+    __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(chars, beforeDigits), _mm_cmplt_epi8(chars, afterDigits));
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(lowered, beforeLetters), _mm_cmplt_epi8(lowered, afterLetters));
+    int alnum = _mm_movemask_epi8(_mm_or_si128(digits, letters));
+    int stops = inWord ? (~alnum & 0xFFFF) : (alnum | _mm_movemask_epi8(chars));
+    if (stops != 0) return p - start + __builtin_ctz(stops);
+    p += 16;
+  }
+#endif
+
+  while (p < limit && (unsigned char) *p < 0x80 && (isalnum((unsigned char) *p) != 0) == inWord) p++;
+  return p - start;
+}
+
+static void STReserveWord(streamtokenizer *st, size_t needed)
+{
+  if (needed <= st->wordSize) return;
+  while (st->wordSize < needed) st->wordSize = (st->wordSize == 0) ? 64 : 2 * st->wordSize;
+  st->word = realloc(st->word, st->wordSize);
+  assert(st->word != NULL);
+}
+
+// makes sure at least count characters are in the window beyond the cursor, unless the input runs out first
+static void STEnsure(streamtokenizer *st, size_t count)
+{
+  while ((size_t) (st->limit - st->cursor) < count && STRefill(st))
+    ;
+}
+
+/**
+ * Scans the next word into st->word, case folded and null-terminated, and
+ * sets *length to its length in bytes.  Returns false if there are no words
+ * left.  Characters are consumed as they're folded, so a word can be any
+ * length no matter how small the window is.
+ */
+
+static bool STScanWord(streamtokenizer *st, size_t *length)
+{
+  const unsigned char *p;
+  int cp, width;
+
+  // skip separators
+  while (true) {
+    st->cursor += AsciiRun(st->cursor, st->limit, false);
+    if (st->cursor < st->limit && (unsigned char) *st->cursor < 0x80) break;  // an ASCII letter or digit
+    STEnsure(st, 4);
+    if (st->cursor == st->limit) return false;
+
+    p = (const unsigned char *) st->cursor;
+    width = DecodeUTF8(p, (const unsigned char *) st->limit, &cp);
+    if (IsWordCodePoint(cp)) break;
+    st->cursor += width;
+  }
+
+  size_t used = 0;
+  while (true) {
+    size_t run = AsciiRun(st->cursor, st->limit, true);
+    STReserveWord(st, used + run + 5);
+    for (size_t i = 0; i < run; i++) {
+      unsigned char ch = st->cursor[i];
+      st->word[used + i] = (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+    }
+    used += run;
+    st->cursor += run;
+
+    // only an apostrophe or a character beyond ASCII can extend the word
+    if (st->cursor < st->limit && (unsigned char) *st->cursor < 0x80 && *st->cursor != '\'') break;
+    STEnsure(st, 8);
+    if (st->cursor == st->limit) break;
+    p = (const unsigned char *) st->cursor;
+    width = DecodeUTF8(p, (const unsigned char *) st->limit, &cp);
+
+    if (cp == '\'' || cp == kRightSingleQuotationMark) {
+      int next;
+      if (p + width == (const unsigned char *) st->limit) break;
+      DecodeUTF8(p + width, (const unsigned char *) st->limit, &next);
+      if (!IsWordCodePoint(next)) break;
+      st->word[used++] = '\'';
+    } else if (IsWordCodePoint(cp)) {
+      used += EncodeUTF8(FoldCodePoint(cp), st->word + used);
+    } else {
       break;
     }
-    buffer[i] = next;
+    st->cursor += width;
   }
 
-  // also include the final delimiter
-  buffer[i++] = next; 
-  
-  // i indexes place where null-term should be placed...
-  buffer[i] = '\0';
- 
-  // unwind chars
-  if (DEBUG_STREAM) printf("unwinding stream...");
-  fseek(st->infile,streamPtr,SEEK_SET);
+  st->word[used] = '\0';
+  *length = used;
+  return true;
+}
+
+// like STScanWord, but skips the words the normalizer rejects
+static bool STScanNormalizedWord(streamtokenizer *st, size_t *length)
+{
+  int normalizedLength;
 
+  do {
+    if (!STScanWord(st, length)) return false;
+    normalizedLength = *length;
+  } while (!STNormalize(st, st->word, &normalizedLength));
+
+  *length = normalizedLength;
+  st->word[*length] = '\0';
   return true;
 }
 
-static bool HaveReasonToStop(const char *charSet, int next, bool skipping)
+void STSetNormalizer(streamtokenizer *st, STNormalizeFunction normalizefn, void *auxData)
 {
-  bool inSet = (strchr(charSet, next) != NULL);
-  return ((inSet && !skipping) || (!inSet && skipping));
+  st->normalizefn = normalizefn;
+  st->normalizeData = auxData;
 }
 
-static int STSkipHelper(streamtokenizer *st, const char *charSet, bool skipping)
+int STFoldCase(char *text, int length)
 {
-  int next;
-  
-  while (true) {
-    next = getc(st->infile);
-    if (next == EOF) return EOF;
-    if (HaveReasonToStop(charSet, next, skipping)) break;
+  const unsigned char *p = (const unsigned char *) text;
+  const unsigned char *limit = p + length;
+  char *out = text;
+  int cp;
+
+  while (p < limit) {
+    if (*p < 0x80) {
+      *out++ = (*p >= 'A' && *p <= 'Z') ? *p + ('a' - 'A') : *p;
+      p++;
+      continue;
+    }
+
+    int width = DecodeUTF8(p, limit, &cp);
+    if (cp < 0)
+      *out++ = *p;  // invalid sequences pass through untouched
+    else
+      out += EncodeUTF8(FoldCodePoint(cp), out);  // never longer than the original
+    p += width;
   }
-  
-  ungetc(next, st->infile); 
-  return next;
+  return out - text;
 }
 
-int STSkipUntil(streamtokenizer *st, const char *skipUntilSet)
+bool STNextWord(streamtokenizer *st, char buffer[], int bufferLength)
 {
-  return STSkipHelper(st, skipUntilSet, false);
+  size_t length;
+
+  assert(buffer != NULL);
+  assert(bufferLength >= 2);
+
+  if (!STScanNormalizedWord(st, &length)) return false;
+
+  // truncate overlong words, backing up to the start of any partial character
+  if (length > (size_t) bufferLength - 1) {
+    length = bufferLength - 1;
+    while (length > 0 && ((unsigned char) st->word[length] & 0xC0) == 0x80) length--;
+  }
+
+  memcpy(buffer, st->word, length);
+  buffer[length] = '\0';
+  return true;
 }
 
-int STSkipOver(streamtokenizer *st, const char *skipSet)
+int STForEachWord(streamtokenizer *st, STTokenFunction wordfn, void *auxData)
+{
+  size_t length;
+  int count = 0;
+
+  assert(wordfn != NULL);
+
+  while (STScanNormalizedWord(st, &length)) {
+    wordfn(st->word, length, auxData);
+    count++;
+  }
+  return count;
+}
+
+// ranges shorter than this aren't worth a thread of their own
+static const size_t kMinParallelRange = 256 * 1024;
+
+typedef struct {
+  const char *bytes;
+  size_t length;
+  const char *delimiters;
+  bool discardDelimiters;
+  tokenview *tokens;
+  int numTokens;
+  bool threaded;          // whether the job got a thread of its own to run on
+} tokenizejob;
+
+static void *TokenizeWorker(void *arg)
+{
+  tokenizejob *job = arg;
+  streamtokenizer st;
+  int allocated = 1024;
+  int count;
+
+  job->tokens = malloc(allocated * sizeof(tokenview));
+  assert(job->tokens != NULL);
+  job->numTokens = 0;
+
+  STNewFromBuffer(&st, job->bytes, job->length, job->delimiters, job->discardDelimiters);
+  do {
+    if (allocated - job->numTokens < 256) {
+      allocated *= 2;
+      job->tokens = realloc(job->tokens, allocated * sizeof(tokenview));
+      assert(job->tokens != NULL);
+    }
+    count = STNextTokens(&st, job->tokens + job->numTokens, allocated - job->numTokens);
+    job->numTokens += count;
+  } while (count > 0);
+  STDispose(&st);
+  return NULL;
+}
+
+void STTokenizeParallel(const char *bytes, size_t length, const char *delimiters,
+                        bool discardDelimiters, vector *tokens, int numThreads)
 {
-  return STSkipHelper(st, skipSet, true);
+  delimiterset set;
+
+  assert(bytes != NULL || length == 0);
+  assert(delimiters != NULL && strlen(delimiters) > 0);
+  assert(tokens != NULL && tokens->elemSize == sizeof(tokenview));
+
+  if (numThreads <= 0) numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  if ((size_t) numThreads > length / kMinParallelRange) numThreads = length / kMinParallelRange;
+  if (numThreads < 1) numThreads = 1;
+
+  tokenizejob *jobs = malloc(numThreads * sizeof(tokenizejob));
+  pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+  assert(jobs != NULL && threads != NULL);
+
+  // every range but the first starts on a delimiter, which no token ever spans
+  CompileDelimiters(&set, delimiters);
+  const char *start = bytes;
+  for (int t = 0; t < numThreads; t++) {
+    const char *end = bytes + length;
+    if (t < numThreads - 1) {
+      end = bytes + length / numThreads * (t + 1);
+      if (end < start) end = start;
+      end = FindInBuffer(&set, end, bytes + length, true);
+    }
+
+    jobs[t].bytes = start;
+    jobs[t].length = end - start;
+    jobs[t].delimiters = delimiters;
+    jobs[t].discardDelimiters = discardDelimiters;
+    start = end;
+  }
+
+  // the calling thread takes the first range itself, and any range it
+  // can't start a thread for
+  for (int t = 1; t < numThreads; t++) {
+    jobs[t].threaded = (pthread_create(&threads[t], NULL, TokenizeWorker, &jobs[t]) == 0);
+    if (!jobs[t].threaded) TokenizeWorker(&jobs[t]);
+  }
+  TokenizeWorker(&jobs[0]);
+  for (int t = 1; t < numThreads; t++)
+    if (jobs[t].threaded) pthread_join(threads[t], NULL);
+
+  int total = VectorLength(tokens);
+  for (int t = 0; t < numThreads; t++)
+    total += jobs[t].numTokens;
+  VectorReserve(tokens, total);
+
+  for (int t = 0; t < numThreads; t++) {
+    for (int i = 0; i < jobs[t].numTokens; i++)
+      VectorAppend(tokens, &jobs[t].tokens[i]);
+    free(jobs[t].tokens);
+  }
+
+  free(jobs);
+  free(threads);
 }
@@ -2,6 +2,7 @@
 #define _streamtokenizer_
 
 #include "bool.h"
+#include "vector.h"
 #include <stdio.h>
 
 /**
@@ -30,19 +31,102 @@
  * It could do anything at all with the token that populates the client-supplied
  * character buffer called word.
  *
- * Note that the client should not at all access the three fields of
+ * A streamtokenizer can also be layered over bytes that are already in
+ * memory (see STNewFromBuffer), in which case no stdio calls are made at
+ * all and STNextTokenView hands back tokens without copying them.
+ *
+ * Delimiter strings are compiled into a 256-entry bitmap (the delimiterset)
+ * so that classifying a character costs the same no matter how many
+ * delimiters there are.  The set passed to STNew is compiled once and
+ * cached; sets passed to the UsingDifferentDelimiters-style functions are
+ * compiled on each call.  Over a buffer, on x86-64 processors with SSSE3,
+ * runs of characters are classified 16 at a time.
+ *
+ * A third kind of streamtokenizer (see STNewPush) doesn't pull its input
+ * at all: the client pushes it in, in pieces of any size, as it arrives
+ * (typically off the network), and tokens are handed to a client function
+ * as soon as they're complete.
+ *
+ * Over a FILE *, the streamtokenizer reads ahead into a window of its own
+ * and tokenizes that exactly as it would a buffer.  Looking ahead
+ * (STLookAtNextToken) just examines the window without consuming anything,
+ * so it never seeks and works as well on pipes and sockets as on files.
+ *
+ * Note that the client should not at all access the fields of
  * streamtokenizer directly.  The only reason you see them here is because
  * there's no easy way to hide them in C.  You should pretend that they've
  * been marked as private.  Let the implementations of all the streamtokenizer
  * functions manage the fields for you.
  */
 
+/**
+ * Type: STTokenFunction
+ * ---------------------
+ * Class of function called once for each token, in order, by
+ * STForEachToken and by a streamtokenizer created with STNewPush.  It
+ * receives the address of the token's first character, the number of
+ * characters in the token (which is *not* null-terminated), and the
+ * client's auxData.  The characters are only valid for the duration of
+ * the call, and the function mustn't call any other streamtokenizer
+ * function on the same streamtokenizer.
+ */
+
+typedef void (*STTokenFunction)(const char *token, int length, void *auxData);
+
+/**
+ * Type: STNormalizeFunction
+ * -------------------------
+ * Class of function that can be installed with STSetNormalizer to
+ * rewrite or reject every token before the client sees it.  It receives
+ * the token, writable in place, with *length characters followed by a
+ * '\0', and the auxData passed to STSetNormalizer.  It may rewrite the
+ * characters and shorten the token (updating *length), but never lengthen
+ * it, and returns false to reject the token outright.
+ */
+
+typedef bool (*STNormalizeFunction)(char *token, int *length, void *auxData);
+
+typedef struct {
+  unsigned char bits[32];
+  unsigned char nibbles[16];
+  bool ascii;
+} delimiterset;
+
 typedef struct {
   FILE *infile;
   const char *delimiters;
+  delimiterset delimiterSet;
   bool discardDelimiters;
+  const char *cursor;
+  const char *limit;
+  char *window;
+  size_t windowSize;
+  bool atEOF;
+  STTokenFunction tokenfn;
+  void *auxData;
+  char *word;
+  size_t wordSize;
+  STNormalizeFunction normalizefn;
+  void *normalizeData;
 } streamtokenizer;
 
+/**
+ * Type: tokenview
+ * ---------------
+ * Identifies a token without copying it: start addresses the first
+ * character of the token and length counts its characters.  The token
+ * is *not* null-terminated.  For a streamtokenizer created by
+ * STNewFromBuffer, start points directly into the client's buffer and
+ * remains valid for as long as that buffer does.  For one reading from a
+ * FILE *, it points into storage owned by the streamtokenizer and is only
+ * valid until the next call to a streamtokenizer function.
+ */
+
+typedef struct {
+  const char *start;
+  int length;
+} tokenview;
+
 /**
  * Function: STNew
  * ---------------
@@ -62,10 +146,95 @@ typedef struct {
  *        The infile stream is non-NULL.
  *        The delimiter string is non-NULL.
  *        The delimiter string isn't the empty string.
+ *
+ * Because the streamtokenizer reads ahead in large blocks, the client
+ * shouldn't read from infile directly until STDispose has been called.
  */
 
 void STNew(streamtokenizer *st, FILE *infile, const char *delimiters, bool discardDelimiters);
 
+/**
+ * Function: STNewFromBuffer
+ * -------------------------
+ * Initializes the specified streamtokenizer to tokenize the length
+ * bytes starting at the specified address, rather than the contents
+ * of a FILE *.  Delimiters are interpreted exactly as they are by STNew,
+ * and every streamtokenizer function works the same way over a buffer
+ * as it does over a stream, except that no stdio calls are made.
+ *
+ * The bytes are neither copied nor modified, so they must remain valid
+ * (and unchanged) until STDispose is called.  They needn't be
+ * null-terminated.
+ *
+ * The function asserts that bytes is non-NULL (unless length is 0)
+ * and that the delimiter string is non-NULL and non-empty.
+ */
+
+void STNewFromBuffer(streamtokenizer *st, const char *bytes, size_t length,
+                     const char *delimiters, bool discardDelimiters);
+
+/**
+ * Function: STSetBuffer
+ * ---------------------
+ * Points a streamtokenizer created with STNewFromBuffer at a different
+ * buffer, abandoning whatever was left of the old one.  Its delimiters,
+ * normalizer and scratch storage are all kept, which makes tokenizing a
+ * long series of small buffers much cheaper than initializing and
+ * disposing of a streamtokenizer for each one.
+ */
+
+void STSetBuffer(streamtokenizer *st, const char *bytes, size_t length);
+
+/**
+ * Function: STNewPush
+ * -------------------
+ * Initializes the specified streamtokenizer to accept its input through
+ * STFeed rather than reading it from a FILE * or a buffer.  Tokens are
+ * formed just as STNextToken would form them from the concatenation of
+ * everything fed in, and each one is passed to tokenfn (along with auxData)
+ * as soon as it's known to be complete, so a token split across two
+ * chunks is still delivered whole.  For example, to index a page while it
+ * downloads:
+ *
+ *     static void FeedTokenizer(const char *bytes, size_t length, void *auxData)
+ *     {
+ *         STFeed(auxData, bytes, length);
+ *     }
+ *
+ *     STNewPush(&st, kTextDelimiters, true, IndexWord, &index);
+ *     URLConnectionNewStreaming(&conn, &u, FeedTokenizer, &st);
+ *     STFinish(&st);
+ *
+ * Only STFeed, STFinish and STDispose may be applied to a streamtokenizer
+ * initialized this way.  Asserts that the delimiter string is non-NULL and
+ * non-empty and that tokenfn is non-NULL.
+ */
+
+void STNewPush(streamtokenizer *st, const char *delimiters, bool discardDelimiters,
+               STTokenFunction tokenfn, void *auxData);
+
+/**
+ * Function: STFeed
+ * ----------------
+ * Tokenizes the next length bytes of input, passing every token that
+ * completes within them to the tokenfn supplied to STNewPush.  A token
+ * still running at the end of the bytes is copied aside until a later
+ * STFeed (or STFinish) completes it; nothing else is copied, and the bytes
+ * needn't outlive the call.  Returns the number of tokens passed to tokenfn.
+ */
+
+int STFeed(streamtokenizer *st, const char *bytes, size_t length);
+
+/**
+ * Function: STFinish
+ * ------------------
+ * Signals the end of the input, passing the final token to tokenfn if one
+ * was still waiting for more bytes.  Returns the number of tokens passed to
+ * tokenfn (0 or 1).  The streamtokenizer may then be fed a new input.
+ */
+
+int STFinish(streamtokenizer *st);
+
 /**
  * Function: STDispose
  * -------------------
@@ -146,13 +315,83 @@ bool STNextToken(streamtokenizer *st, char buffer[], int bufferLength);
 bool STNextTokenUsingDifferentDelimiters(streamtokenizer *st, char buffer[], int bufferLength,
 										 const char *delimiters);
 
+/**
+ * Function: STNextTokenView
+ * -------------------------
+ * Forms the next token exactly as STNextToken does, but rather than
+ * copying it into a client buffer, describes where it lives through the
+ * specified tokenview (see the tokenview type for how long it stays valid).
+ * Because nothing is copied, there's no buffer to fill up and long tokens
+ * are never chopped into pieces.  Returns false, leaving the tokenview
+ * untouched, if there are no tokens left.
+ *
+ * Over a buffer created by STNewFromBuffer this is the fastest way to pull
+ * tokens: it makes no stdio calls and no copies.
+ */
+
+bool STNextTokenView(streamtokenizer *st, tokenview *token);
+
+/**
+ * Function: STNextTokenViewUsingDifferentDelimiters
+ * -------------------------------------------------
+ * Is to STNextTokenView what STNextTokenUsingDifferentDelimiters is to
+ * STNextToken.
+ */
+
+bool STNextTokenViewUsingDifferentDelimiters(streamtokenizer *st, tokenview *token,
+                                             const char *delimiters);
+
+/**
+ * Function: STForEachToken
+ * ------------------------
+ * Pulls every remaining token (formed with the streamtokenizer's own
+ * delimiters, exactly as STNextToken would form them) and passes each one
+ * to tokenfn.  The whole loop runs inside the streamtokenizer, so there's
+ * no per-token call overhead beyond tokenfn itself, and tokens are never
+ * chopped to fit a buffer.  Returns the number of tokens passed to tokenfn.
+ *
+ *     static void CountWord(const char *word, int length, void *auxData)
+ *     {
+ *         if (length > 0 && isalpha((unsigned char) word[0])) (*(int *) auxData)++;
+ *     }
+ *
+ *     int numWords = 0;
+ *     STForEachToken(&st, CountWord, &numWords);
+ *
+ * An assert is raised if tokenfn is NULL.
+ */
+
+int STForEachToken(streamtokenizer *st, STTokenFunction tokenfn, void *auxData);
+
+/**
+ * Function: STNextTokens
+ * ----------------------
+ * Fills as much of the client's tokens array (up to maxTokens entries)
+ * as it can with the next tokens, and returns the number of entries
+ * filled in, which is 0 only once there are no tokens left.  Over a buffer
+ * created by STNewFromBuffer, the views remain valid as long as the buffer
+ * does.  Over a FILE *, they are all valid until the next call to a
+ * streamtokenizer function; to keep them so, a batch stops short of
+ * maxTokens rather than read any more of the stream once it holds at least
+ * one token.
+ *
+ * An assert is raised if tokens is NULL or maxTokens isn't positive.
+ */
+
+int STNextTokens(streamtokenizer *st, tokenview tokens[], int maxTokens);
+
 /**
  * Function: STLookAtNextToken
  * ---------------------------------------------
  * Performs the same operation at STNextTokenUsingDifferentDelimiters, except
  * rather than advancing the stream pointer, it leaves the stream at
  * the same position where it was when entering into this function.
- *  
+ * Unless the token is a lone delimiter, the delimiter that ends it is
+ * included at the end of the buffer (provided there's room for it).
+ *
+ * The token is copied straight out of the streamtokenizer's own lookahead
+ * window, so peeking costs no more than the length of the token and
+ * doesn't require the underlying stream to be seekable.
  */
 
 bool STLookAtNextToken(streamtokenizer *st, char buffer[], int bufferLength, const char *delimiters);
@@ -210,4 +449,127 @@ int STSkipOver(streamtokenizer *st, const char *skipSet);
 
 int STSkipUntil(streamtokenizer *st, const char *skipUntilSet);
 
+/**
+ * Function: STPeek
+ * Usage: size_t available = STPeek(&st, 9, &bytes);
+ * ----------------
+ * Exposes the unread input directly, for parsers that need to examine it
+ * in ways the delimiter-based functions can't.  Reads ahead until at least
+ * minimum characters are available (or the input runs out), sets *bytes to
+ * the address of the next unread character, and returns how many
+ * characters can be examined there, which may be more than minimum.
+ * Nothing is consumed.  The characters are not null-terminated, and over
+ * a FILE * they're only valid until the next call to a streamtokenizer
+ * function, which may move them; over a buffer they're the client's own.
+ * A return value below minimum means the input has been exhausted.  Not
+ * available to a streamtokenizer created with STNewPush.
+ */
+
+size_t STPeek(streamtokenizer *st, size_t minimum, const char **bytes);
+
+/**
+ * Function: STAdvance
+ * -------------------
+ * Consumes the next count characters, which must already have been made
+ * available by STPeek.
+ */
+
+void STAdvance(streamtokenizer *st, size_t count);
+
+/**
+ * Function: STNextWord
+ * --------------------
+ * Pulls the next word, rather than the next token, and writes it
+ * (null-terminated) into the client buffer.  Words are formed without
+ * reference to the delimiter set: the input is read as UTF-8, and a word
+ * is a maximal run of letters and digits from any script, with an ASCII
+ * apostrophe or a right single quotation mark (U+2019) allowed between two
+ * of them ("don't" and "o’clock" are each one word).  Everything else,
+ * including nonbreaking spaces, curly quotes, dashes and other Unicode
+ * punctuation, separates words and is never returned.
+ *
+ * Each word is case folded before it's written (ASCII, Latin-1, Latin
+ * Extended-A, Greek and Cyrillic letters are folded to lowercase, and
+ * every apostrophe becomes an ASCII one), so "Café" and "CAFÉ" produce the
+ * same word.  A word too long for the buffer is truncated to whole UTF-8
+ * characters that fit, and the rest of it is skipped.
+ *
+ * Runs of ASCII are classified 16 characters at a time (on x86-64), and
+ * only characters outside ASCII are decoded one at a time.
+ *
+ * Returns false if there are no words left.  Asserts that buffer is
+ * non-NULL and bufferLength is at least 2.
+ */
+
+bool STNextWord(streamtokenizer *st, char buffer[], int bufferLength);
+
+/**
+ * Function: STForEachWord
+ * -----------------------
+ * Is to STNextWord what STForEachToken is to STNextToken: it passes every
+ * remaining word, case folded and never truncated, to wordfn, and returns
+ * the number of words passed.  An assert is raised if wordfn is NULL.
+ */
+
+int STForEachWord(streamtokenizer *st, STTokenFunction wordfn, void *auxData);
+
+/**
+ * Function: STTokenizeParallel
+ * ----------------------------
+ * Tokenizes the length bytes at the specified address exactly as a
+ * streamtokenizer created by STNewFromBuffer (with the same delimiters and
+ * discardDelimiters) would, but splits the work across numThreads threads,
+ * and appends a tokenview for every token to the client's tokens vector,
+ * in document order.  The vector must have been created with an element
+ * size of sizeof(tokenview); the views point into bytes, so they're valid
+ * for as long as it is.  Pass 0 for numThreads to use one thread per online
+ * processor.  Small inputs get fewer threads (a single thread below a
+ * quarter of a megabyte), since starting one would cost more than it saves.
+ *
+ * The buffer is cut into one range per thread, and each cut is nudged
+ * forward onto a delimiter, where no token can straddle it.
+ *
+ *     vector tokens;
+ *     VectorNew(&tokens, sizeof(tokenview), NULL, 0);
+ *     STTokenizeParallel(page, pageLength, kTextDelimiters, true, &tokens, 0);
+ */
+
+void STTokenizeParallel(const char *bytes, size_t length, const char *delimiters,
+                        bool discardDelimiters, vector *tokens, int numThreads);
+
+/**
+ * Function: STSetNormalizer
+ * -------------------------
+ * Installs normalizefn as a normalization stage between tokenizing and
+ * the client: from then on, every token produced by STNextToken,
+ * STForEachToken, STNextWord and STForEachWord is first passed to
+ * normalizefn (along with auxData), and tokens it rejects are dropped
+ * and replaced by the next token.  The functions that take
+ * different delimiters or hand back tokenviews into the input are
+ * unaffected.  Passing NULL removes the normalizer.  See NormalizeWord in
+ * word-utils.h for a ready-made one.
+ */
+
+void STSetNormalizer(streamtokenizer *st, STNormalizeFunction normalizefn, void *auxData);
+
+/**
+ * Function: STFoldCase
+ * --------------------
+ * Case folds the length bytes of UTF-8 text in place, exactly as
+ * STNextWord folds words, and returns the new length, which is never
+ * greater than the old one.  Bytes that aren't valid UTF-8 are left alone.
+ */
+
+int STFoldCase(char *text, int length);
+
+/**
+ * Function: STNextChar
+ * --------------------
+ * Pulls the very next character from the streamtokenizer, delimiter or
+ * not, and returns it (as an unsigned char converted to an int), or returns
+ * EOF if there are no characters left.
+ */
+
+int STNextChar(streamtokenizer *st);
+
 #endif
@@ -0,0 +1,558 @@
+#include "trie.h"
+#include <assert.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Every node starts with a twelve-byte header.  What follows depends on
+ * the node type, and the node's compressed prefix always comes last:
+ *
+ *   leaf:    prefix
+ *   node4:   4 sorted key bytes, 4 children, prefix
+ *   node16:  16 sorted key bytes, 16 children, prefix
+ *   node48:  256-entry index (child slot + 1, or 0), 48 children, prefix
+ *   node256: 256 children indexed directly by byte, prefix
+ *
+ * A key ends at a node when that node's frequency is non-zero.
+ */
+
+typedef struct {
+	unsigned int frequency;
+	unsigned int maxFrequency;
+	unsigned short numChildren;
+	unsigned char type;
+	unsigned char prefixLength;
+} trienode;
+
+enum { kLeaf, kNode4, kNode16, kNode48, kNode256 };
+
+static const int kCapacity[] = { 0, 4, 16, 48, 256 };
+static const int kChildrenOffset[] = { 12, 16, 32, 272, 16 };
+static const int kPrefixOffset[] = { 12, 48, 160, 656, 2064 };
+static const int kMaxPrefix = 255;
+
+// nodes are carved out of big chunks, and recycled through per-size free lists
+#define kChunkBytes (64 * 1024)
+#define kAlignment 8
+#define kNumSizeClasses ((2064 + 255) / kAlignment + 2)
+
+typedef struct triechunk {
+	struct triechunk *next;
+} triechunk;
+
+typedef struct {
+	triechunk *chunks;
+	char *cursor;
+	char *limit;
+	size_t reserved;
+	void *freeLists[kNumSizeClasses];
+} triearena;
+
+static void *ArenaAlloc(triearena *a, size_t size)
+{
+	size_t sizeClass = (size + kAlignment - 1) / kAlignment;
+	assert(sizeClass < kNumSizeClasses);
+
+	void *block = a->freeLists[sizeClass];
+	if (block != NULL) {
+		a->freeLists[sizeClass] = *(void **)block;
+		return block;
+	}
+
+	size_t bytes = sizeClass * kAlignment;
+	if (a->cursor == NULL || (size_t)(a->limit - a->cursor) < bytes) {
+		triechunk *chunk = malloc(kChunkBytes);
+		assert(chunk != NULL);
+		chunk->next = a->chunks;
+		a->chunks = chunk;
+		a->cursor = (char *)chunk + sizeof(triechunk);
+		a->limit = (char *)chunk + kChunkBytes;
+		a->reserved += kChunkBytes;
+	}
+	block = a->cursor;
+	a->cursor += bytes;
+	return block;
+}
+
+static void ArenaFree(triearena *a, void *block, size_t size)
+{
+	size_t sizeClass = (size + kAlignment - 1) / kAlignment;
+	*(void **)block = a->freeLists[sizeClass];
+	a->freeLists[sizeClass] = block;
+}
+
+static size_t NodeSize(int type, int prefixLength)
+{
+	return kPrefixOffset[type] + prefixLength;
+}
+
+static unsigned char *Keys(const trienode *node)
+{
+	return (unsigned char *)node + sizeof(trienode);
+}
+
+static trienode **Children(const trienode *node)
+{
+	return (trienode **)((char *)node + kChildrenOffset[node->type]);
+}
+
+static unsigned char *Prefix(const trienode *node)
+{
+	return (unsigned char *)node + kPrefixOffset[node->type];
+}
+
+static trienode *NewNode(triearena *a, int type, const unsigned char *prefix, int prefixLength)
+{
+	trienode *node = ArenaAlloc(a, NodeSize(type, prefixLength));
+	node->frequency = 0;
+	node->maxFrequency = 0;
+	node->numChildren = 0;
+	node->type = type;
+	node->prefixLength = prefixLength;
+	memcpy(Prefix(node), prefix, prefixLength);
+
+	if (type == kNode48) memset(Keys(node), 0, 256);
+	if (type == kNode256) memset(Children(node), 0, 256 * sizeof(trienode *));
+	return node;
+}
+
+static void FreeNode(triearena *a, trienode *node)
+{
+	ArenaFree(a, node, NodeSize(node->type, node->prefixLength));
+}
+
+// builds the leaf for the rest of a key, chaining nodes if it's too long for one prefix
+static trienode *NewLeaf(triearena *a, const unsigned char *key, int length, unsigned int frequency)
+{
+	if (length <= kMaxPrefix) {
+		trienode *leaf = NewNode(a, kLeaf, key, length);
+		leaf->frequency = frequency;
+		leaf->maxFrequency = frequency;
+		return leaf;
+	}
+
+	trienode *node = NewNode(a, kNode4, key, kMaxPrefix);
+	node->maxFrequency = frequency;
+	node->numChildren = 1;
+	Keys(node)[0] = key[kMaxPrefix];
+	Children(node)[0] = NewLeaf(a, key + kMaxPrefix + 1, length - kMaxPrefix - 1, frequency);
+	return node;
+}
+
+static trienode **FindChild(const trienode *node, unsigned char c)
+{
+	switch (node->type) {
+	case kNode4:
+	case kNode16:
+		for (int i = 0; i < node->numChildren && Keys(node)[i] <= c; i++) {
+			if (Keys(node)[i] == c) return &Children(node)[i];
+		}
+		return NULL;
+	case kNode48:
+		if (Keys(node)[c] == 0) return NULL;
+		return &Children(node)[Keys(node)[c] - 1];
+	case kNode256:
+		if (Children(node)[c] == NULL) return NULL;
+		return &Children(node)[c];
+	default:
+		return NULL;
+	}
+}
+
+// returns the smallest byte >= from that has a child (and the child), or -1
+static int NextChild(const trienode *node, int from, const trienode **child)
+{
+	switch (node->type) {
+	case kNode4:
+	case kNode16:
+		for (int i = 0; i < node->numChildren; i++) {
+			if (Keys(node)[i] >= from) {
+				*child = Children(node)[i];
+				return Keys(node)[i];
+			}
+		}
+		return -1;
+	case kNode48:
+		for (int c = from; c < 256; c++) {
+			if (Keys(node)[c] != 0) {
+				*child = Children(node)[Keys(node)[c] - 1];
+				return c;
+			}
+		}
+		return -1;
+	case kNode256:
+		for (int c = from; c < 256; c++) {
+			if (Children(node)[c] != NULL) {
+				*child = Children(node)[c];
+				return c;
+			}
+		}
+		return -1;
+	default:
+		return -1;
+	}
+}
+
+// replaces a full node with the next size up
+static trienode *Grow(triearena *a, trienode *node)
+{
+	trienode *bigger = NewNode(a, node->type + 1, Prefix(node), node->prefixLength);
+	bigger->frequency = node->frequency;
+	bigger->maxFrequency = node->maxFrequency;
+	bigger->numChildren = node->numChildren;
+
+	switch (node->type) {
+	case kNode4:
+		memcpy(Keys(bigger), Keys(node), node->numChildren);
+		memcpy(Children(bigger), Children(node), node->numChildren * sizeof(trienode *));
+		break;
+	case kNode16:
+		for (int i = 0; i < node->numChildren; i++) {
+			Keys(bigger)[Keys(node)[i]] = i + 1;
+			Children(bigger)[i] = Children(node)[i];
+		}
+		break;
+	case kNode48:
+		for (int c = 0; c < 256; c++) {
+			if (Keys(node)[c] != 0)
+				Children(bigger)[c] = Children(node)[Keys(node)[c] - 1];
+		}
+		break;
+	}
+
+	FreeNode(a, node);
+	return bigger;
+}
+
+static void AddChild(triearena *a, trienode **ref, unsigned char c, trienode *child)
+{
+	trienode *node = *ref;
+	if (node->numChildren == kCapacity[node->type])
+		node = *ref = Grow(a, node);
+
+	switch (node->type) {
+	case kNode4:
+	case kNode16: {
+		int pos = 0;
+		while (pos < node->numChildren && Keys(node)[pos] < c) pos++;
+		memmove(&Keys(node)[pos + 1], &Keys(node)[pos], node->numChildren - pos);
+		memmove(&Children(node)[pos + 1], &Children(node)[pos], (node->numChildren - pos) * sizeof(trienode *));
+		Keys(node)[pos] = c;
+		Children(node)[pos] = child;
+		break;
+	}
+	case kNode48:
+		Children(node)[node->numChildren] = child;
+		Keys(node)[c] = node->numChildren + 1;
+		break;
+	case kNode256:
+		Children(node)[c] = child;
+		break;
+	}
+	node->numChildren++;
+}
+
+// reallocates the node without the first drop bytes of its prefix
+static trienode *DropPrefix(triearena *a, trienode *node, int drop)
+{
+	trienode *shorter = NewNode(a, node->type, Prefix(node) + drop, node->prefixLength - drop);
+	memcpy((char *)shorter + sizeof(trienode), (char *)node + sizeof(trienode),
+	       kPrefixOffset[node->type] - sizeof(trienode));
+	shorter->frequency = node->frequency;
+	shorter->maxFrequency = node->maxFrequency;
+	shorter->numChildren = node->numChildren;
+	FreeNode(a, node);
+	return shorter;
+}
+
+void TrieNew(trie *t)
+{
+	assert(t != NULL);
+
+	t->root = NULL;
+	t->count = 0;
+	t->arena = calloc(1, sizeof(triearena));
+	assert(t->arena != NULL);
+}
+
+void TrieDispose(trie *t)
+{
+	assert(t != NULL);
+
+	triearena *a = t->arena;
+	while (a->chunks != NULL) {
+		triechunk *next = a->chunks->next;
+		free(a->chunks);
+		a->chunks = next;
+	}
+	free(a);
+	t->arena = NULL;
+	t->root = NULL;
+	t->count = 0;
+}
+
+int TrieCount(const trie *t)
+{
+	assert(t != NULL);
+
+	return t->count;
+}
+
+/**
+ * Adds increment to the key below *ref, splitting or growing nodes along
+ * the way as needed, and returns the key's new frequency so every node on
+ * the path can fold it into its maxFrequency on the way back up.
+ */
+
+static unsigned int Insert(trie *t, trienode **ref, const unsigned char *key, int length,
+			   unsigned int increment)
+{
+	triearena *a = t->arena;
+	trienode *node = *ref;
+
+	if (node == NULL) {
+		*ref = NewLeaf(a, key, length, increment);
+		t->count++;
+		return increment;
+	}
+
+	int match = 0;
+	while (match < node->prefixLength && match < length && Prefix(node)[match] == key[match])
+		match++;
+
+	if (match < node->prefixLength) {
+		// the key leaves the compressed path part way along, so split it there
+		trienode *parent = NewNode(a, kNode4, Prefix(node), match);
+		parent->maxFrequency = node->maxFrequency;
+		parent->numChildren = 1;
+		Keys(parent)[0] = Prefix(node)[match];
+		Children(parent)[0] = DropPrefix(a, node, match + 1);
+		node = *ref = parent;
+	}
+
+	key += match;
+	length -= match;
+
+	unsigned int frequency;
+	if (length == 0) {
+		if (node->frequency == 0) t->count++;
+		node->frequency = (node->frequency > UINT_MAX - increment) ? UINT_MAX : node->frequency + increment;
+		frequency = node->frequency;
+	} else {
+		trienode **child = FindChild(node, key[0]);
+		if (child != NULL) {
+			frequency = Insert(t, child, key + 1, length - 1, increment);
+		} else {
+			AddChild(a, ref, key[0], NewLeaf(a, key + 1, length - 1, increment));
+			node = *ref;
+			t->count++;
+			frequency = increment;
+		}
+	}
+
+	if (frequency > node->maxFrequency) node->maxFrequency = frequency;
+	return frequency;
+}
+
+void TrieEnter(trie *t, const char *key, int length, unsigned int increment)
+{
+	assert(t != NULL);
+	assert(key != NULL && length >= 0);
+	assert(increment > 0);
+
+	Insert(t, (trienode **)&t->root, (const unsigned char *)key, length, increment);
+}
+
+unsigned int TrieLookup(const trie *t, const char *key, int length)
+{
+	assert(t != NULL);
+	assert(key != NULL && length >= 0);
+
+	const trienode *node = t->root;
+	const unsigned char *bytes = (const unsigned char *)key;
+
+	while (node != NULL) {
+		if (length < node->prefixLength || memcmp(Prefix(node), bytes, node->prefixLength) != 0)
+			return 0;
+		bytes += node->prefixLength;
+		length -= node->prefixLength;
+		if (length == 0) return node->frequency;
+
+		trienode **child = FindChild(node, bytes[0]);
+		if (child == NULL) return 0;
+		node = *child;
+		bytes++;
+		length--;
+	}
+	return 0;
+}
+
+/**
+ * Completions are gathered into a min-heap holding the best n seen so
+ * far.  Keys are visited in ascending order, so among equal frequencies
+ * the one found last (the alphabetically largest) sits at the root and
+ * is the first to be evicted.
+ */
+
+typedef struct {
+	unsigned int frequency;
+	int offset;
+	int length;
+	const char *word;
+} completion;
+
+typedef struct {
+	completion *heap;
+	int heapCount;
+	int n;
+	char *key;
+	int keyLength;
+	int keyCapacity;
+	char *words;
+	int wordsLength;
+	int wordsCapacity;
+} completionsearch;
+
+static void AppendBytes(char **buffer, int *length, int *capacity, const void *bytes, int numBytes)
+{
+	if (numBytes == 0) return;
+	if (*length + numBytes > *capacity) {
+		*capacity = 2 * (*length + numBytes) + 16;
+		*buffer = realloc(*buffer, *capacity);
+		assert(*buffer != NULL);
+	}
+	memcpy(*buffer + *length, bytes, numBytes);
+	*length += numBytes;
+}
+
+static bool HeapLess(const completion *a, const completion *b)
+{
+	if (a->frequency != b->frequency) return a->frequency < b->frequency;
+	return a->offset > b->offset;
+}
+
+static void SiftDown(completionsearch *s, int i)
+{
+	while (true) {
+		int smallest = i, left = 2 * i + 1, right = 2 * i + 2;
+		if (left < s->heapCount && HeapLess(&s->heap[left], &s->heap[smallest])) smallest = left;
+		if (right < s->heapCount && HeapLess(&s->heap[right], &s->heap[smallest])) smallest = right;
+		if (smallest == i) return;
+		completion tmp = s->heap[i];
+		s->heap[i] = s->heap[smallest];
+		s->heap[smallest] = tmp;
+		i = smallest;
+	}
+}
+
+static void Offer(completionsearch *s, unsigned int frequency)
+{
+	if (s->heapCount == s->n && frequency <= s->heap[0].frequency) return;
+
+	completion c = { frequency, s->wordsLength, s->keyLength, NULL };
+	AppendBytes(&s->words, &s->wordsLength, &s->wordsCapacity, s->key, s->keyLength);
+	AppendBytes(&s->words, &s->wordsLength, &s->wordsCapacity, "", 1);
+
+	if (s->heapCount == s->n) {
+		s->heap[0] = c;
+		SiftDown(s, 0);
+		return;
+	}
+
+	int i = s->heapCount++;
+	s->heap[i] = c;
+	while (i > 0 && HeapLess(&s->heap[i], &s->heap[(i - 1) / 2])) {
+		completion tmp = s->heap[i];
+		s->heap[i] = s->heap[(i - 1) / 2];
+		s->heap[(i - 1) / 2] = tmp;
+		i = (i - 1) / 2;
+	}
+}
+
+static void Collect(completionsearch *s, const trienode *node)
+{
+	int mark = s->keyLength;
+	AppendBytes(&s->key, &s->keyLength, &s->keyCapacity, Prefix(node), node->prefixLength);
+	if (node->frequency > 0) Offer(s, node->frequency);
+
+	const trienode *child;
+	for (int c = NextChild(node, 0, &child); c != -1; c = NextChild(node, c + 1, &child)) {
+		// nothing below this child can displace anything already collected
+		if (s->heapCount == s->n && child->maxFrequency <= s->heap[0].frequency) continue;
+		unsigned char edge = c;
+		AppendBytes(&s->key, &s->keyLength, &s->keyCapacity, &edge, 1);
+		Collect(s, child);
+		s->keyLength--;
+	}
+	s->keyLength = mark;
+}
+
+static int CompareCompletions(const void *elemAddr1, const void *elemAddr2)
+{
+	const completion *a = elemAddr1;
+	const completion *b = elemAddr2;
+	if (a->frequency != b->frequency) return (a->frequency < b->frequency) ? 1 : -1;
+
+	int shorter = (a->length < b->length) ? a->length : b->length;
+	int result = memcmp(a->word, b->word, shorter);
+	return (result != 0) ? result : a->length - b->length;
+}
+
+int TrieComplete(const trie *t, const char *prefix, int prefixLength, int n,
+		 TrieCompletionFunction completionfn, void *auxData)
+{
+	assert(t != NULL);
+	assert(prefix != NULL && prefixLength >= 0);
+	assert(completionfn != NULL);
+	assert(n >= 0);
+
+	// walk down to the shallowest node whose keys all begin with the prefix
+	const trienode *node = t->root;
+	const unsigned char *bytes = (const unsigned char *)prefix;
+	int depth = 0;
+	while (node != NULL) {
+		int remaining = prefixLength - depth;
+		if (remaining <= node->prefixLength) {
+			if (memcmp(Prefix(node), bytes + depth, remaining) != 0) node = NULL;
+			break;
+		}
+		if (memcmp(Prefix(node), bytes + depth, node->prefixLength) != 0) {
+			node = NULL;
+			break;
+		}
+		depth += node->prefixLength;
+		trienode **child = FindChild(node, bytes[depth]);
+		node = (child != NULL) ? *child : NULL;
+		depth++;
+	}
+	if (node == NULL || n == 0) return 0;
+
+	completionsearch s;
+	memset(&s, 0, sizeof(s));
+	s.n = n;
+	s.heap = malloc(n * sizeof(completion));
+	assert(s.heap != NULL);
+	AppendBytes(&s.key, &s.keyLength, &s.keyCapacity, prefix, depth);
+
+	Collect(&s, node);
+
+	for (int i = 0; i < s.heapCount; i++)
+		s.heap[i].word = s.words + s.heap[i].offset;
+	qsort(s.heap, s.heapCount, sizeof(completion), CompareCompletions);
+	for (int i = 0; i < s.heapCount; i++)
+		completionfn(s.heap[i].word, s.heap[i].length, s.heap[i].frequency, auxData);
+
+	int found = s.heapCount;
+	free(s.heap);
+	free(s.key);
+	free(s.words);
+	return found;
+}
+
+size_t TrieMemoryUsage(const trie *t)
+{
+	assert(t != NULL);
+
+	return sizeof(triearena) + ((triearena *)t->arena)->reserved;
+}
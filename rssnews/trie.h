@@ -0,0 +1,125 @@
+#ifndef __trie_
+#define __trie_
+#include "bool.h"
+#include <stddef.h>
+
+/* File: trie.h
+ * ------------
+ * Defines the interface for the trie, a compact map from byte-string
+ * keys (typically the words of the indexed vocabulary) to occurrence
+ * counts, built for prefix search and autocompletion.
+ *
+ * The trie is an adaptive radix tree: each node grows through four
+ * sizes (4, 16, 48 and 256 children) only as it needs to, and runs of
+ * bytes that don't branch are collapsed into the node itself, so most
+ * words end in a leaf that stores nothing but its unshared suffix.  All
+ * nodes are carved out of large chunks owned by the trie rather than
+ * malloc'd one at a time.
+ *
+ * Storing the same vocabulary as strdup'd char *s in a hashset costs
+ * a bucket slot, a heap block and the malloc bookkeeping for every word
+ * (typically 40 or more bytes per short English word); TrieMemoryUsage
+ * reports what the trie is actually using so the two can be compared.
+ */
+
+/**
+ * Type: TrieCompletionFunction
+ * ----------------------------
+ * Class of function called once for each completion produced by
+ * TrieComplete.  It receives the full key (null-terminated, and
+ * length bytes long not counting the terminator), the frequency
+ * recorded for it, and the auxData passed to TrieComplete.  The word
+ * is only valid for the duration of the call.
+ */
+
+typedef void (*TrieCompletionFunction)(const char *word, int length,
+				       unsigned int frequency, void *auxData);
+
+/**
+ * Type: trie
+ * ----------
+ * The concrete representation of the trie.  The client should
+ * treat every field as private and go through the functions below.
+ */
+
+typedef struct {
+  void *root;
+  int count;
+  void *arena;
+} trie;
+
+/**
+ * Function: TrieNew
+ * -----------------
+ * Initializes the specified trie to be empty.
+ */
+
+void TrieNew(trie *t);
+
+/**
+ * Function: TrieDispose
+ * ---------------------
+ * Releases all memory owned by the trie.  Keys were copied into the
+ * trie as they were entered, so there's nothing for the client to free.
+ */
+
+void TrieDispose(trie *t);
+
+/**
+ * Function: TrieCount
+ * -------------------
+ * Returns the number of distinct keys residing in the trie.
+ */
+
+int TrieCount(const trie *t);
+
+/**
+ * Function: TrieEnter
+ * -------------------
+ * Adds increment to the frequency associated with the length-byte key,
+ * inserting the key with that frequency if it isn't already present.
+ * Keys are arbitrary bytes (embedded '\0's are fine) and the empty key
+ * is a legal key.  Frequencies saturate rather than wrap.
+ *
+ * An assert is raised if key is NULL, length is negative, or increment
+ * is zero.
+ */
+
+void TrieEnter(trie *t, const char *key, int length, unsigned int increment);
+
+/**
+ * Function: TrieLookup
+ * --------------------
+ * Returns the frequency associated with the length-byte key, or 0 if
+ * the key isn't present.
+ */
+
+unsigned int TrieLookup(const trie *t, const char *key, int length);
+
+/**
+ * Function: TrieComplete
+ * ----------------------
+ * Finds the (at most) n most frequent keys that begin with the
+ * prefixLength-byte prefix and passes each of them to completionfn,
+ * most frequent first (ties are broken alphabetically).  Every node
+ * records the largest frequency anywhere beneath it, so subtrees that
+ * can't beat the n-th best completion seen so far are never visited.
+ * Returns the number of completions passed to completionfn.
+ *
+ * An assert is raised if prefix or completionfn is NULL, or n is negative.
+ */
+
+int TrieComplete(const trie *t, const char *prefix, int prefixLength, int n,
+		 TrieCompletionFunction completionfn, void *auxData);
+
+/**
+ * Function: TrieMemoryUsage
+ * -------------------------
+ * Returns the number of bytes the trie has acquired from the heap,
+ * including space set aside but not yet handed out to nodes.  Dividing
+ * by TrieCount gives the bytes spent per key.
+ */
+
+size_t TrieMemoryUsage(const trie *t);
+
+#endif
@@ -2,92 +2,742 @@
 #include "assert.h"
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
 #include <stdlib.h>
+#include <ctype.h>
+#include <limits.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #define DEBUG_URL 0
 
+/**
+ * URLs are split up along the lines of the regular expression in
+ * appendix B of RFC 3986, in one pass and without copying anything:
+ * every component is recorded as an offset and a length within the
+ * original text, which is only copied (if at all) once it's known to
+ * parse.
+ */
+
+typedef struct {
+  const char *scheme;
+  int port;
+} schemeport;
+
+static const schemeport kDefaultPorts[] = {
+  { "http", 80 }, { "https", 443 }, { "ftp", 21 }, { "ws", 80 }, { "wss", 443 },
+  { "gopher", 70 }, { "nntp", 119 }, { "telnet", 23 }
+};
+
+static const int kNumDefaultPorts = sizeof(kDefaultPorts) / sizeof(kDefaultPorts[0]);
 
-int find(const char *substring, const char *str, int index)
+// the port assumed for a URL that names neither a scheme nor a port
+static const int kHTTPPort = 80;
+
+static const urlpart kAbsent = { 0, -1 };
+
+static bool IsURLSpace(char ch)
 {
-  assert(str != NULL && substring != NULL);
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r' || ch == '\f';
+}
 
-  if (index > strlen(str)) {
-    return -1;
+static bool IsSchemeChar(char ch)
+{
+  return isalnum((unsigned char) ch) || ch == '+' || ch == '-' || ch == '.';
+}
+
+/**
+ * Returns the offset of the first of the characters a, b and c to appear
+ * in text at or after offset i, or n if none of them appears before n.
+ * (Pass the same character more than once to look for fewer.)  On x86-64
+ * 16 characters are checked at a time, since paths and queries run long.
+ */
+
+static int FindStop(const char *text, int i, int n, char a, char b, char c)
+{
+#ifdef __SSE2__
+  const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b), vc = _mm_set1_epi8(c);
+  while (n - i >= 16) {
+    __m128i chars = _mm_loadu_si128((const __m128i *) (text + i));
+    __m128i hits = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, va), _mm_cmpeq_epi8(chars, vb)),
+                                _mm_cmpeq_epi8(chars, vc));
+    int mask = _mm_movemask_epi8(hits);
+    if (mask != 0) return i + __builtin_ctz(mask);
+    i += 16;
   }
-   
-  char *result = strstr(str + index, substring);
-  if (result == NULL)
-    return -1;
-  int position = result - str;
-  return position;
+#endif
+
+  while (i < n && text[i] != a && text[i] != b && text[i] != c) i++;
+  return i;
 }
 
+int URLDefaultPort(const char *scheme, int length)
+{
+  assert(scheme != NULL && length >= 0);
 
-char* substring(const char* str, int begin, int len) 
-{ 
-  assert(str != NULL);
+  for (int i = 0; i < kNumDefaultPorts; i++)
+    if ((size_t) length == strlen(kDefaultPorts[i].scheme) &&
+        strncasecmp(scheme, kDefaultPorts[i].scheme, length) == 0) return kDefaultPorts[i].port;
+  return 0;
+}
 
-  if (strlen(str) == 0 || strlen(str) < begin || strlen(str) < (begin+len)) 
-    return NULL; 
+/**
+ * Fills in the userinfo, host and port of the authority running from
+ * offset start to offset end of text.  Returns false if the port isn't a
+ * number below 65536 or an IP literal isn't closed.
+ */
 
-  return strndup(str + begin, len); 
-} 
+static bool ParseAuthority(urlview *u, const char *text, int start, int end)
+{
+  const char *p = text + start, *limit = text + end;
 
+  // the userinfo runs to the last '@', since passwords may contain unencoded ones
+  const char *at = NULL;
+  for (const char *q = p; q < limit; q++)
+    if (*q == '@') at = q;
+  if (at != NULL) {
+    u->userinfo.offset = start;
+    u->userinfo.length = at - p;
+    p = at + 1;
+  }
 
-void URLNewAbsolute(url *u, const char *absolutePath)
+  const char *host = p;
+  if (p < limit && *p == '[') {
+    const char *close = memchr(p, ']', limit - p);
+    if (close == NULL) return false;
+    p = close + 1;
+  } else {
+    while (p < limit && *p != ':') p++;
+  }
+  u->host.offset = host - text;
+  u->host.length = p - host;
+  if (p == limit) return true;
+  if (*p != ':') return false;
+
+  p++;
+  u->port.offset = p - text;
+  u->port.length = limit - p;
+  int port = 0;
+  for (; p < limit; p++) {
+    if (!isdigit((unsigned char) *p)) return false;
+    port = 10 * port + (*p - '0');
+    if (port > USHRT_MAX) return false;
+  }
+  if (u->port.length > 0) u->portNumber = port;
+  return true;
+}
+
+/**
+ * Does the work of URLParse on the n characters of text.  If bareServer
+ * is true, as it is for URLNewAbsolute, a scheme only counts when it's
+ * followed by "//", and text that doesn't begin with a '/' is taken to
+ * begin with a server name, so that "www.kottke.org/about" and
+ * "localhost:8080/" both parse as they're meant.
+ */
+
+static bool ParseReference(urlview *u, const char *text, int n, bool bareServer)
 {
-  char *tempString = NULL;
-  int pos1 = 0, pos2 = 0;
+  u->scheme = u->userinfo = u->host = u->port = u->path = u->query = u->fragment = kAbsent;
+  u->portNumber = 0;
 
-  assert(absolutePath != NULL);
-  assert(strlen(absolutePath) > 2);
+  int i = 0;
+  if (n > 0 && isalpha((unsigned char) text[0])) {
+    int j = 1;
+    while (j < n && IsSchemeChar(text[j])) j++;
+    if (j < n && text[j] == ':' && (!bareServer || (n - j >= 3 && text[j + 1] == '/' && text[j + 2] == '/'))) {
+      u->scheme.offset = 0;
+      u->scheme.length = j;
+      i = j + 1;
+    }
+  }
 
-  if (DEBUG_URL) printf("building url from %s\n",absolutePath);
+  bool hasAuthority = n - i >= 2 && text[i] == '/' && text[i + 1] == '/';
+  if (hasAuthority) i += 2;
+  if (hasAuthority || (bareServer && i == 0 && n > 0 && text[0] != '/')) {
+    int end = FindStop(text, i, n, '/', '?', '#');
+    if (!ParseAuthority(u, text, i, end)) return false;
+    i = end;
+  }
+
+  u->path.offset = i;
+  i = FindStop(text, i, n, '?', '#', '#');
+  u->path.length = i - u->path.offset;
+
+  if (i < n && text[i] == '?') {
+    u->query.offset = ++i;
+    i = FindStop(text, i, n, '#', '#', '#');
+    u->query.length = i - u->query.offset;
+  }
+  if (i < n && text[i] == '#') {
+    u->fragment.offset = i + 1;
+    u->fragment.length = n - i - 1;
+  }
+
+  if (u->port.length <= 0 && u->scheme.length > 0)
+    u->portNumber = URLDefaultPort(text + u->scheme.offset, u->scheme.length);
+  return true;
+}
+
+static bool Parse(urlview *u, const char *text, size_t length, char buffer[], size_t bufferLength,
+                  bool bareServer)
+{
+  assert(u != NULL && (text != NULL || length == 0));
+
+  u->ownsText = false;
+  bool inPlace = buffer == text;
+  while (length > 0 && IsURLSpace(*text)) {
+    text++;
+    length--;
+  }
+  while (length > 0 && IsURLSpace(text[length - 1])) length--;
+  if (length >= INT_MAX || !ParseReference(u, text, length, bareServer)) return false;
+
+  u->textLength = length;
+  if (inPlace) {
+    u->text = text;
+    return true;
+  }
+
+  if (buffer == NULL) {
+    buffer = malloc(length + 1);
+    assert(buffer != NULL);
+    u->ownsText = true;
+  } else if (bufferLength < length + 1) {
+    return false;
+  }
+  memcpy(buffer, text, length);
+  buffer[length] = '\0';
+  u->text = buffer;
+  return true;
+}
+
+bool URLParse(urlview *u, const char *text, size_t length, char buffer[], size_t bufferLength)
+{
+  return Parse(u, text, length, buffer, bufferLength, false);
+}
 
-  // determine the port number (default to be 80)
-  u->port = 80;
-  pos1 = find(":", absolutePath, 0);
-  if (pos1 > 0) {
-    tempString = substring(absolutePath, 0, pos1);
-    assert(tempString != NULL);
+void URLViewDispose(urlview *u)
+{
+  if (u->ownsText) free((void *) u->text);
+}
+
+// copies the part of v's text into block, null-terminated, and returns where the copy begins
+static const char *CopyPart(char **block, const urlview *v, int offset, int length)
+{
+  char *copy = *block;
+  memcpy(copy, v->text + offset, length);
+  copy[length] = '\0';
+  *block += length + 1;
+  return copy;
+}
+
+/**
+ * Fills in u from the parsed URL, placing its four strings one after
+ * the other in a single block.  The fullName comes first, so it's the
+ * address of the whole block.
+ */
+
+static void URLFromView(url *u, const urlview *v)
+{
+  int hostLength = (v->host.length > 0) ? v->host.length : 0;
+  int start = (v->userinfo.length >= 0) ? v->userinfo.offset : v->host.offset;
+  if (hostLength == 0 && v->userinfo.length < 0) start = v->path.offset;
+  int end = (v->query.length >= 0) ? v->query.offset + v->query.length : v->path.offset + v->path.length;
+
+  int fileOffset = v->path.offset, fileLength = v->path.length;
+  if (fileLength > 0 && v->text[fileOffset] == '/') {
+    fileOffset++;
+    fileLength--;
+  }
+
+  static const char kDefaultScheme[] = "http";
+  int schemeLength = (v->scheme.length >= 0) ? v->scheme.length : (int) strlen(kDefaultScheme);
+
+  char *block = malloc((end - start) + hostLength + fileLength + schemeLength + 4);
+  assert(block != NULL);
+  u->fullName = CopyPart(&block, v, start, end - start);
+  u->serverName = CopyPart(&block, v, v->host.offset, hostLength);
+  u->fileName = CopyPart(&block, v, fileOffset, fileLength);
+
+  char *scheme = block;
+  if (v->scheme.length >= 0) {
+    for (int i = 0; i < schemeLength; i++) scheme[i] = tolower((unsigned char) v->text[v->scheme.offset + i]);
+  } else {
+    memcpy(scheme, kDefaultScheme, schemeLength);
+  }
+  scheme[schemeLength] = '\0';
+  u->scheme = scheme;
+
+  u->port = (v->port.length > 0 || v->scheme.length >= 0) ? v->portNumber : kHTTPPort;
+}
+
+// what URLNewAbsolute and URLNewRelative leave behind when given something that isn't a URL
+static void URLClear(url *u)
+{
+  u->fullName = u->serverName = u->fileName = u->scheme = NULL;
+  u->port = 0;
+}
+
+/**
+ * Reference resolution (RFC 3986, section 5.2) works on components
+ * located by pointer rather than by offset, since those of the base and
+ * those of the reference live in different strings.  The authority is
+ * taken whole: whatever of userinfo, host and port is there.
+ */
+
+typedef struct {
+  const char *start;
+  int length;       // -1 if the component is absent
+} span;
+
+typedef struct {
+  span scheme;
+  span authority;
+  span path;
+  span query;
+  span fragment;
+} components;
+
+static span SpanOf(const urlview *v, urlpart part)
+{
+  span s = { v->text + part.offset, part.length };
+  return s;
+}
+
+static void ComponentsOf(const urlview *v, components *c)
+{
+  c->scheme = SpanOf(v, v->scheme);
+  c->path = SpanOf(v, v->path);
+  c->query = SpanOf(v, v->query);
+  c->fragment = SpanOf(v, v->fragment);
+
+  c->authority.length = -1;
+  if (v->host.length >= 0) {
+    int start = (v->userinfo.length >= 0) ? v->userinfo.offset : v->host.offset;
+    int end = (v->port.length >= 0) ? v->port.offset + v->port.length : v->host.offset + v->host.length;
+    c->authority.start = v->text + start;
+    c->authority.length = end - start;
+  }
+}
+
+/**
+ * Returns the length of the merged path (section 5.2.3) of the base and
+ * a relative reference's path, before dot segments are removed.
+ */
+
+static int MergedPathLength(const components *base, const span *path)
+{
+  if (base->authority.length >= 0 && base->path.length == 0) return 1 + path->length;
+  const char *slash = NULL;
+  for (const char *p = base->path.start; p < base->path.start + base->path.length; p++)
+    if (*p == '/') slash = p;
+  return ((slash != NULL) ? slash + 1 - base->path.start : 0) + path->length;
+}
+
+static bool IsRelativePath(const components *reference)
+{
+  return reference->scheme.length < 0 && reference->authority.length < 0 &&
+    reference->path.length > 0 && reference->path.start[0] != '/';
+}
+
+// the components of the target, as section 5.2.2 picks them, with the path left for Resolve
+static void PickTarget(const components *base, const components *reference, components *target)
+{
+  *target = *reference;
+  if (reference->scheme.length >= 0) return;
+  target->scheme = base->scheme;
+  if (reference->authority.length >= 0) return;
+  target->authority = base->authority;
+  if (reference->path.length == 0) {
+    target->path = base->path;
+    if (reference->query.length < 0) target->query = base->query;
+  }
+}
+
+// the length of the resolved URL before its dot segments are removed
+static int UnreducedLength(const components *base, const components *reference)
+{
+  components target;
+  PickTarget(base, reference, &target);
+
+  int length = IsRelativePath(reference) ? MergedPathLength(base, &reference->path) : target.path.length;
+  if (target.scheme.length >= 0) length += target.scheme.length + 1;
+  if (target.authority.length >= 0) length += 2 + target.authority.length;
+  if (target.query.length >= 0) length += 1 + target.query.length;
+  if (target.fragment.length >= 0) length += 1 + target.fragment.length;
+  return length;
+}
+
+/**
+ * Removes the "." and ".." segments from the length characters of path,
+ * in place, as section 5.2.4 describes, and returns the new length.  The
+ * output never runs ahead of the input, so one buffer does for both.
+ */
+
+static int RemoveDotSegments(char *path, int length)
+{
+  const char *in = path, *end = path + length;
+  char *out = path;
 
-    if (DEBUG_URL) printf("tempString: %s\n",tempString);
-    if (strcmp(tempString,"https") == 0) {
-      u->port = 443;
+  while (in < end) {
+    int left = end - in;
+    if (left >= 3 && memcmp(in, "../", 3) == 0) {
+      in += 3;
+    } else if (left >= 2 && memcmp(in, "./", 2) == 0) {
+      in += 2;
+    } else if (left >= 3 && memcmp(in, "/./", 3) == 0) {
+      in += 2;
+    } else if (left == 2 && memcmp(in, "/.", 2) == 0) {
+      *out++ = '/';
+      in = end;
+    } else if ((left >= 4 && memcmp(in, "/../", 4) == 0) || (left == 3 && memcmp(in, "/..", 3) == 0)) {
+      while (out > path && out[-1] != '/') out--;   // drop the last segment written
+      if (out > path) out--;                        // and the '/' before it
+      if (left == 3) {
+        *out++ = '/';
+        in = end;
+      } else {
+        in += 3;
+      }
+    } else if ((left == 1 && in[0] == '.') || (left == 2 && memcmp(in, "..", 2) == 0)) {
+      in = end;
+    } else {
+      // moves the first segment, along with any '/' before it, to the output
+      do {
+        *out++ = *in++;
+      } while (in < end && *in != '/');
     }
-    free(tempString);
+  }
+  return out - path;
+}
+
+// copies the span to out + *used, after the prefix if there is one, and records where it landed in *part
+static void Place(char *out, int *used, char prefix, span s, urlpart *part)
+{
+  *part = kAbsent;
+  if (s.length < 0) return;
+  if (prefix != '\0') out[(*used)++] = prefix;
+  memcpy(out + *used, s.start, s.length);
+  part->offset = *used;
+  part->length = s.length;
+  *used += s.length;
+}
+
+/**
+ * Writes the resolution of reference against base to out, which must
+ * have room for UnreducedLength characters, and fills in the components
+ * of u as it goes, so the result never needs parsing again.  Returns the
+ * length of the result.
+ */
+
+static int Resolve(const components *base, const components *reference, char *out, urlview *u)
+{
+  components target;
+  PickTarget(base, reference, &target);
+
+  int used = 0;
+  Place(out, &used, '\0', target.scheme, &u->scheme);
+  if (u->scheme.length >= 0) out[used++] = ':';
+
+  u->userinfo = u->host = u->port = kAbsent;
+  u->portNumber = 0;
+  if (target.authority.length >= 0) {
+    out[used++] = '/';
+    urlpart authority;
+    Place(out, &used, '/', target.authority, &authority);
+    ParseAuthority(u, out, authority.offset, authority.offset + authority.length);  // parsed once already
+  }
+
+  int pathStart = used;
+  if (IsRelativePath(reference)) {
+    int baseLength = MergedPathLength(base, &reference->path) - reference->path.length;
+    if (base->authority.length >= 0 && base->path.length == 0) out[used] = '/';
+    else memcpy(out + used, base->path.start, baseLength);
+    used += baseLength;
+    memcpy(out + used, reference->path.start, reference->path.length);
+    used += reference->path.length;
   } else {
-    pos1 = -3;
-  }
-  if (DEBUG_URL) printf("    pos1 = %d\n",pos1);
-
-  // extract the fullName
-  tempString = substring(absolutePath, pos1+3, strlen(absolutePath)-(pos1+3));
-  if (tempString == NULL) {
-    if (DEBUG_URL) printf("pos1: %d, length: %lu, absolutePath: %s\n",pos1, strlen(absolutePath), absolutePath);
-  }
-  assert(tempString != NULL);
-  u->fullName = strdup(tempString);
-  free(tempString);
-
-  // extract the serverName
-  pos2 = find("/", absolutePath, pos1 + 3);
-  if (pos2 == -1)
-    pos2 = strlen(absolutePath);
-  if (DEBUG_URL) printf("    pos2 = %d\n",pos2);
-  
-  tempString = substring(absolutePath, pos1 + 3, pos2 - (pos1 + 3));
-  assert(tempString != NULL);
-  u->serverName = strdup(tempString);
-  free(tempString);
-
-  // extract the fileName
-  tempString = substring(absolutePath, pos2, strlen(absolutePath)-(pos2));
-  assert(tempString != NULL);
-  u->fileName = strdup(tempString);
-  free(tempString);
-
-  if (DEBUG_URL) printf("    strlen(absolutePath) = %lu\n",strlen(absolutePath));
+    Place(out, &used, '\0', target.path, &u->path);
+  }
+  // the base's own path is taken as it stands when the reference has none
+  bool inherited = reference->scheme.length < 0 && reference->authority.length < 0 &&
+    reference->path.length == 0;
+  if (!inherited) used = pathStart + RemoveDotSegments(out + pathStart, used - pathStart);
+  u->path.offset = pathStart;
+  u->path.length = used - pathStart;
+
+  Place(out, &used, '?', target.query, &u->query);
+  Place(out, &used, '#', target.fragment, &u->fragment);
+
+  if (u->port.length <= 0 && u->scheme.length > 0)
+    u->portNumber = URLDefaultPort(out + u->scheme.offset, u->scheme.length);
+  return used;
+}
+
+bool URLResolve(urlview *u, const urlview *base, const char *reference, size_t length,
+                char buffer[], size_t bufferLength)
+{
+  assert(u != NULL && base != NULL && u != base);
+  assert(buffer == NULL || buffer != reference);
+
+  urlview relative;
+  if (!URLParse(&relative, reference, length, (char *) reference, 0)) return false;
+
+  components baseComponents, referenceComponents;
+  ComponentsOf(base, &baseComponents);
+  ComponentsOf(&relative, &referenceComponents);
+
+  size_t bound = UnreducedLength(&baseComponents, &referenceComponents);
+  u->ownsText = buffer == NULL;
+  if (u->ownsText) {
+    buffer = malloc(bound + 1);
+    assert(buffer != NULL);
+  } else if (bufferLength < bound + 1) {
+    return false;
+  }
+
+  u->textLength = Resolve(&baseComponents, &referenceComponents, buffer, u);
+  buffer[u->textLength] = '\0';
+  u->text = buffer;
+  return true;
+}
+
+/**
+ * Canonicalization (RFC 3986, section 6.2.2, plus the clean-ups a crawler
+ * needs) rewrites each component as it copies it, so, as with Resolve,
+ * the components of the result are recorded rather than parsed again.
+ */
+
+typedef struct {
+  const char *name;
+  bool isPrefix;    // true if any name beginning with name is meant
+} trackingparameter;
+
+static const trackingparameter kTrackingParameters[] = {
+  { "utm_", true }, { "fbclid", false }, { "gclid", false }, { "mc_cid", false }, { "mc_eid", false }
+};
+
+static const int kNumTrackingParameters = sizeof(kTrackingParameters) / sizeof(kTrackingParameters[0]);
+
+static const char kHexDigits[] = "0123456789ABCDEF";
+
+static bool IsUnreserved(unsigned char ch)
+{
+  return isalnum(ch) || ch == '-' || ch == '.' || ch == '_' || ch == '~';
+}
+
+/**
+ * One bit per byte value, set for those Normalize can't copy as they are:
+ * '%', which begins an escape, and those that can't appear in a URL at
+ * all (control characters, space, '"', '<', '>', '\', '^', '`', '{', '|',
+ * '}', DEL and everything beyond ASCII).
+ */
+
+static const uint32_t kSpecialBytes[8] = {
+  0xFFFFFFFF, 0x50000025, 0x50000000, 0xB8000001, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+static bool IsSpecial(unsigned char ch)
+{
+  return (kSpecialBytes[ch >> 5] >> (ch & 31)) & 1;
+}
+
+static int HexValue(char ch)
+{
+  if (ch >= '0' && ch <= '9') return ch - '0';
+  ch = tolower((unsigned char) ch);
+  return (ch >= 'a' && ch <= 'f') ? ch - 'a' + 10 : -1;
+}
+
+/**
+ * Copies the length characters at s to out with their escapes normalized,
+ * as URLCanonicalize describes, and lowercased as well if foldCase is
+ * true (the hex digits of an escape stay uppercase regardless).  Writes
+ * at most 3 * length characters, and returns the number written.
+ */
+
+static int Normalize(char *out, const char *s, int length, bool foldCase)
+{
+  char *start = out;
+  for (int i = 0; i < length; i++) {
+    unsigned char ch = s[i];
+    if (!IsSpecial(ch)) {
+      *out++ = foldCase ? tolower(ch) : ch;
+      continue;
+    }
+
+    int high, low;
+    bool escaped = ch == '%' && i + 2 < length &&
+      (high = HexValue(s[i + 1])) >= 0 && (low = HexValue(s[i + 2])) >= 0;
+    if (escaped) {
+      ch = 16 * high + low;
+      i += 2;
+    }
+    if (!escaped || !IsUnreserved(ch)) {
+      *out++ = '%';
+      *out++ = kHexDigits[ch >> 4];
+      *out++ = kHexDigits[ch & 0xF];
+    } else {
+      *out++ = foldCase ? tolower(ch) : ch;
+    }
+  }
+  return out - start;
+}
+
+// true if the name of the length-character query parameter (as in "utm_source=rss") is a tracking one
+static bool IsTrackingParameter(const char *parameter, int length)
+{
+  const char *equals = memchr(parameter, '=', length);
+  size_t nameLength = (equals != NULL) ? (size_t) (equals - parameter) : (size_t) length;
+  for (int i = 0; i < kNumTrackingParameters; i++) {
+    size_t n = strlen(kTrackingParameters[i].name);
+    if ((kTrackingParameters[i].isPrefix ? nameLength >= n : nameLength == n) &&
+        strncasecmp(parameter, kTrackingParameters[i].name, n) == 0) return true;
+  }
+  return false;
+}
+
+/**
+ * Writes the canonical form of v, which must have a scheme and a server,
+ * to out, which must have room for 3 * v->textLength + 1 characters, and
+ * fills in the components of u as it goes.  Returns the length written.
+ */
+
+static int Canonicalize(const urlview *v, char *out, urlview *u)
+{
+  const char *text = v->text;
+  int used = 0;
+  u->userinfo = u->port = u->query = u->fragment = kAbsent;
+
+  u->scheme.offset = 0;
+  u->scheme.length = v->scheme.length;
+  for (int i = 0; i < v->scheme.length; i++) out[used++] = tolower((unsigned char) text[v->scheme.offset + i]);
+  memcpy(out + used, "://", 3);
+  used += 3;
+
+  if (v->userinfo.length >= 0) {
+    u->userinfo.offset = used;
+    u->userinfo.length = Normalize(out + used, text + v->userinfo.offset, v->userinfo.length, false);
+    used += u->userinfo.length;
+    out[used++] = '@';
+  }
+
+  u->host.offset = used;
+  u->host.length = Normalize(out + used, text + v->host.offset, v->host.length, true);
+  while (u->host.length > 0 && out[used + u->host.length - 1] == '.') u->host.length--;
+  used += u->host.length;
+
+  u->portNumber = v->portNumber;
+  if (v->port.length > 0 && v->portNumber != URLDefaultPort(out, u->scheme.length)) {
+    out[used++] = ':';
+    u->port.offset = used;
+    u->port.length = sprintf(out + used, "%u", v->portNumber);
+    used += u->port.length;
+  }
+
+  u->path.offset = used;
+  u->path.length = Normalize(out + used, text + v->path.offset, v->path.length, false);
+  u->path.length = RemoveDotSegments(out + used, u->path.length);
+  if (u->path.length == 0) out[used + u->path.length++] = '/';
+  else if (u->path.length > 1 && out[used + u->path.length - 1] == '/') u->path.length--;
+  used += u->path.length;
+
+  if (v->query.length >= 0) {
+    const char *parameter = text + v->query.offset, *end = parameter + v->query.length;
+    int queryStart = used + 1, kept = queryStart;
+    while (parameter < end) {
+      const char *ampersand = memchr(parameter, '&', end - parameter);
+      if (ampersand == NULL) ampersand = end;
+      if (ampersand > parameter && !IsTrackingParameter(parameter, ampersand - parameter)) {
+        if (kept > queryStart) out[kept++] = '&';
+        kept += Normalize(out + kept, parameter, ampersand - parameter, false);
+      }
+      if (ampersand == end) break;
+      parameter = ampersand + 1;
+    }
+    if (kept > queryStart) {
+      out[used] = '?';
+      u->query.offset = queryStart;
+      u->query.length = kept - queryStart;
+      used = kept;
+    }
+  }
+  return used;
+}
+
+bool URLCanonicalize(urlview *u, const urlview *v, char buffer[], size_t bufferLength)
+{
+  assert(u != NULL && v != NULL && u != v);
+  assert(buffer == NULL || buffer != v->text);
+
+  if (v->scheme.length <= 0 || v->host.length < 0) return false;
+  size_t bound = 3 * (size_t) v->textLength + 1;
+  u->ownsText = buffer == NULL;
+  if (u->ownsText) {
+    buffer = malloc(bound + 1);
+    assert(buffer != NULL);
+  } else if (bufferLength < bound + 1) {
+    return false;
+  }
+
+  u->textLength = Canonicalize(v, buffer, u);
+  buffer[u->textLength] = '\0';
+  u->text = buffer;
+  return true;
+}
+
+/**
+ * 64-bit FNV-1a, finished with MurmurHash3's fmix64 so that URLs differing
+ * only near their ends still differ in every bit, whichever bits a table
+ * of fingerprints happens to index by.
+ */
+
+static uint64_t Hash64(const char *s, int length)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for (int i = 0; i < length; i++) {
+    hash ^= (unsigned char) s[i];
+    hash *= 1099511628211ull;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+uint64_t URLFingerprint(const urlview *v)
+{
+  assert(v != NULL);
+
+  // most URLs canonicalize on the stack
+  char local[1024];
+  size_t bound = 3 * (size_t) v->textLength + 2;
+  char *buffer = (bound <= sizeof(local)) ? local : malloc(bound);
+  assert(buffer != NULL);
+
+  urlview canonical;
+  uint64_t fingerprint = URLCanonicalize(&canonical, v, buffer, bound) ?
+    Hash64(canonical.text, canonical.textLength) : Hash64(v->text, v->textLength);
+  if (buffer != local) free(buffer);
+  return fingerprint;
+}
+
+void URLNewAbsolute(url *u, const char *absolutePath)
+{
+  assert(absolutePath != NULL);
+
+  if (DEBUG_URL) printf("building url from %s\n",absolutePath);
+
+  urlview v;
+  if (!Parse(&v, absolutePath, strlen(absolutePath), (char *) absolutePath, 0, true)) {
+    URLClear(u);
+    return;
+  }
+  URLFromView(u, &v);
 
   if (DEBUG_URL) printf("fullName: %s\n",u->fullName);
   if (DEBUG_URL) printf("fileName: %s\n",u->fileName);
@@ -98,36 +748,45 @@ void URLNewAbsolute(url *u, const char *absolutePath)
 
 void URLNewRelative(url *u, const url *parentURL, const char *relativePath)
 {
-  // determine if relativePath is actually an absolutePath
-  // ie does it have a "." in the path
+  assert(parentURL != NULL && relativePath != NULL);
+
   if (DEBUG_URL) printf("entered URLNewRelative\n");
-  int pos = find(".", relativePath, 0);
-  if (DEBUG_URL) printf("pos: %d\n",pos);
-  if (pos > 0) {
-    if (DEBUG_URL) printf("creating NewAbsolute\n");
-    URLNewAbsolute(u, relativePath);
-  } else {
-    if (DEBUG_URL) printf("creating NewAbsolute\n");
 
-    char *newURL = malloc(strlen(parentURL->serverName) + strlen(relativePath));
-    strcpy(newURL, parentURL->serverName);
+  // the parent's fullName parses in place, and its scheme is kept apart from it
+  urlview parent, relative;
+  if (parentURL->fullName == NULL ||
+      !Parse(&parent, parentURL->fullName, strlen(parentURL->fullName), (char *) parentURL->fullName, 0, true) ||
+      !URLParse(&relative, relativePath, strlen(relativePath), (char *) relativePath, 0)) {
+    if (DEBUG_URL) printf("couldn't resolve %s\n", relativePath);
+    URLClear(u);
+    return;
+  }
 
-    if (DEBUG_URL) printf("strlen(newURL) = %lu\n",strlen(newURL));
-    if (DEBUG_URL) printf("sizeof(newURL) = %lu\n",sizeof(newURL));
+  components base, reference;
+  ComponentsOf(&parent, &base);
+  base.scheme.start = parentURL->scheme;
+  base.scheme.length = strlen(parentURL->scheme);
+  ComponentsOf(&relative, &reference);
 
-    strncat(newURL, relativePath, sizeof(newURL) - strlen(newURL) - 1);
+  // short results are assembled on the stack
+  char local[1024];
+  int bound = UnreducedLength(&base, &reference);
+  char *resolved = ((size_t) bound < sizeof(local)) ? local : malloc(bound + 1);
+  assert(resolved != NULL);
 
-    URLNewAbsolute(u, relativePath);
-  }
+  urlview v;
+  v.textLength = Resolve(&base, &reference, resolved, &v);
+  v.text = resolved;
+  URLFromView(u, &v);
+  if (resolved != local) free(resolved);
+
+  if (DEBUG_URL) printf("resolved %s to %s\n", relativePath, u->fullName);
 }
 
 
 void URLDispose(url *u)
 {
-  if (u->fileName != NULL)
-    free((void *)u->fileName);
-  if (u->serverName != NULL)
-    free((void *)u->serverName);
+  // the other strings share the fullName's block
   if (u->fullName != NULL)
     free((void *)u->fullName);
 }
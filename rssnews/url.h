@@ -7,14 +7,19 @@
 #ifndef __url_
 #define __url_
 
+#include "bool.h"
+#include <stddef.h>
+#include <stdint.h>
+
 /**
  * Exposed struct: url
  * -------------------
  * Manages all of the various components of a full URL.
  * The client should initialize a url instance using either
  * URLNewAbsolute or URLNewRelative, and then treat each of
- * the four fields as read only.  The client should rely
- * on URLDispose to release the three strings embedded inside.
+ * the five fields as read only.  The client should rely
+ * on URLDispose to release the strings embedded inside,
+ * which all share a single allocation.
  */
 
 typedef struct {
@@ -22,19 +27,73 @@ typedef struct {
   const char *serverName;
   const char *fileName;
   unsigned short port;
+  const char *scheme;
 } url;
 
+/**
+ * Exposed struct: urlpart
+ * -----------------------
+ * Locates one component of a parsed URL within the urlview's text:
+ * the component is the length characters starting offset characters
+ * in.  A component the URL doesn't have at all has a length of -1,
+ * which is different from one that's present but empty (as the query
+ * is in "http://a.com/?").
+ */
+
+typedef struct {
+  int offset;
+  int length;
+} urlpart;
+
+/**
+ * Exposed struct: urlview
+ * -----------------------
+ * A URL parsed into its RFC 3986 components, each described by a
+ * urlpart rather than copied out into a string of its own:
+ *
+ *     https://anna@news.example.com:8443/world/index.rss?page=2#top
+ *     \___/   \__/ \______________/ \__/\______________/ \____/ \_/
+ *     scheme userinfo    host       port     path        query  fragment
+ *
+ * None of the delimiters (the "://", '@', ':', '?' or '#') are included.
+ * The host of an IP literal keeps its brackets ("[::1]").  portNumber is
+ * the explicit port if there is one, and otherwise the scheme's default
+ * (80 for http, 443 for https, and so forth), or 0 if it has none.  The
+ * client should initialize a urlview with URLParse, treat its fields as
+ * read only, and release it with URLViewDispose.
+ */
+
+typedef struct {
+  const char *text;
+  int textLength;
+  urlpart scheme;
+  urlpart userinfo;
+  urlpart host;
+  urlpart port;
+  urlpart path;
+  urlpart query;
+  urlpart fragment;
+  unsigned short portNumber;
+  bool ownsText;
+} urlview;
+
 /**
  * Function: URLNewAbsolute
  * Usage: URLNewAbsolute(&myFriendsBlog, "adam.gillitt.com");
  * ----------------------------------------------------------
  * Accepts the address of a presumably raw url struct, and populates
- * its four fields based on the contents of the absolute path.  The
- * assumption is that the resource is accessible via an HTTP server, unless
- * some other protocol prefixes the absolute path.  At the moment, we only
- * support http, though future iterations might support https and ftp.
- * So the "http://" at the front is completely optional.  We assume by default
- * that all HTTP servers listen to port 80.
+ * its five fields based on the contents of the absolute path, as parsed
+ * by URLParse.  The assumption is that the resource is accessible via an
+ * HTTP server, unless some other protocol prefixes the absolute path, so
+ * the "http://" at the front is completely optional.  The port is the one
+ * given in the path, if any, and otherwise the scheme's default (see
+ * URLDefaultPort).  The fullName runs from the server name through the
+ * query, if there is one; the fileName is just the path, without its
+ * leading '/'.  Fragments ("#section") never reach the server, so they're
+ * dropped.  If absolutePath isn't a URL at all (its port isn't a number
+ * below 65536, or an IP literal's ']' is missing), all four strings are
+ * set to NULL and the port to 0, so the client should check fullName
+ * before using the url; URLDispose is still safe to call.
  *
  * URLNewAbsolute(&stanfordDeptsURL, "http://www.stanford.edu/home/academics/departments.html");
  * URLNewAbsolute(&stanfordDeptsURL, "www.stanford.edu/home/academics/departments.html");
@@ -45,7 +104,8 @@ typedef struct {
  *              "www.stanford.edu/home/academics/departments.html",
  *              "www.stanford.edu",
  *              "home/academics/departments.html",
- *              80 
+ *              80,
+ *              "http"
  *            }
  *
  * URLNewAbsolute(&kottkeURL, "http://www.kottke.org"); 
@@ -56,7 +116,8 @@ typedef struct {
  *              "www.kottke.org",
  *              "www.kottke.org",
  *              "",
- *              80
+ *              80,
+ *              "http"
  *            }
  */
 
@@ -67,7 +128,8 @@ void URLNewAbsolute(url *u, const char *absolutePath);
  * Usage: URLNewRelative(&kottkeContactURL, &kottkeURL, "/about/contact.html");
  * ----------------------------------------------------------------------------
  * Initializes the contents of the first url from the information embedded within
- * the parentURL and the relativePath string. 
+ * the parentURL and the relativePath string, which is resolved against the
+ * parentURL as RFC 3986 prescribes (see URLResolve).
  *
  * URLNewRelative(&kottkeContactURL, &kottkeURL, "/about/contact.html");
  *
@@ -78,12 +140,17 @@ void URLNewAbsolute(url *u, const char *absolutePath);
  *              "www.kottke.org/about/contact.html",
  *              "www.kottke.org",
  *              "about/contact.html",
- *              80
+ *              80,
+ *              "http"
  *            }
  *
- * If the relative path is actually an absolute path, then the information
- * within the parentURL is ignored and the url address by u is initialized
- * as if URLNewAbsolute(u, relativePath) were called.  So... 
+ * Paths are relative to the parentURL's directory, so "../img/logo.png"
+ * from "http://a.com/news/today.html" gives "a.com/img/logo.png", while a
+ * path beginning with "//" replaces the server as well ("//cdn.a.com/x.js").
+ * If the relative path is actually an absolute URL, with a scheme at the
+ * front, then the information within the parentURL is ignored and the url
+ * addressed by u is initialized as if URLNewAbsolute(u, relativePath) were
+ * called.  So...
  *
  * URLNewRelative(&bookURL, &amazonTop25FictionURL, "http://www.kiterunner.com/nytimesReview.html");
  * would result in bookURL being set to contain:
@@ -92,8 +159,15 @@ void URLNewAbsolute(url *u, const char *absolutePath);
  *              "www.kiterunner.com/nytimesReview.html"
  *              "www.kiterunner.com",
  *              "nytimesReview.html",
- *              80
+ *              80,
+ *              "http"
  *            }
+ *
+ * A relativePath that isn't a URL reference at all (a malformed link
+ * such as "http://example.com:8o/x"), or a parentURL that URLNewAbsolute
+ * or URLNewRelative couldn't make sense of, leaves u just as a failed
+ * URLNewAbsolute does: every string NULL, and the port 0.  Links come
+ * from pages the client doesn't control, so check fullName.
  */
 
 void URLNewRelative(url *u, const url *parentURL, const char *relativePath);
@@ -107,4 +181,121 @@ void URLNewRelative(url *u, const url *parentURL, const char *relativePath);
 
 void URLDispose(url *u);
 
+/**
+ * Function: URLParse
+ * Usage: if (URLParse(&link, href, hrefLength, NULL, 0)) ...
+ * ------------------
+ * Parses the length characters of text, which needn't be null-terminated,
+ * as a URL or relative reference (RFC 3986), and describes its components
+ * in the urlview addressed by u.  Where the text lives afterwards is up
+ * to the client:
+ *
+ *   - If buffer is NULL, the text is copied into a single block of memory
+ *     owned by the urlview, which URLViewDispose frees.
+ *   - If buffer is the text itself, nothing is copied at all, and the
+ *     urlview refers to the client's text, which must outlive it.
+ *   - Otherwise the text is copied into buffer, which can hold
+ *     bufferLength characters, and null-terminated.
+ *
+ * Leading and trailing white space is ignored.  A reference without a
+ * scheme (or whose "scheme" isn't one, as in "a:b/c") is left relative:
+ * its scheme has a length of -1.  Returns false, leaving nothing to be
+ * disposed of, if the text isn't a URL (the port isn't a number below
+ * 65536, or an IP literal's ']' is missing) or doesn't fit in buffer.
+ */
+
+bool URLParse(urlview *u, const char *text, size_t length, char buffer[], size_t bufferLength);
+
+/**
+ * Function: URLResolve
+ * Usage: URLResolve(&link, &page, href, hrefLength, NULL, 0);
+ * --------------------
+ * Resolves the length characters of reference against the base URL, as
+ * a browser resolves the href of a link against the page it's on, and
+ * parses the result into the urlview addressed by u, exactly as URLParse
+ * would.  The resolution follows section 5 of RFC 3986: the reference
+ * inherits the base's scheme, server, path and query in turn, until it
+ * supplies its own; a relative path is merged with the base's directory;
+ * and the "." and ".." segments are removed.  For instance, against
+ * "http://a.com/b/c/d;p?q":
+ *
+ *     "g"  -> "http://a.com/b/c/g"      "../g"     -> "http://a.com/b/g"
+ *     "?y" -> "http://a.com/b/c/d;p?y"  "//g.org/" -> "http://g.org/"
+ *     "#s" -> "http://a.com/b/c/d;p?q#s"
+ *
+ * The result is assembled directly where it's to be kept, as URLParse
+ * describes for buffer (which mustn't be the reference itself), with no
+ * other allocation.  Returns false if the reference isn't a URL, or if
+ * buffer is too small to assemble the result in.  u mustn't be base.
+ */
+
+bool URLResolve(urlview *u, const urlview *base, const char *reference, size_t length,
+                char buffer[], size_t bufferLength);
+
+/**
+ * Function: URLCanonicalize
+ * Usage: if (URLCanonicalize(&key, &link, NULL, 0)) ...
+ * -------------------------
+ * Rewrites the absolute URL v in a canonical form, so that the many ways
+ * of writing the same address come out the same, and parses the result
+ * into the urlview addressed by u, with buffer treated as URLParse treats
+ * it (except that it mustn't be v's text).  The canonical form
+ *
+ *   - lowercases the scheme and host, and drops any '.' ending the host;
+ *   - drops the port if it's the scheme's default;
+ *   - decodes %-escapes of letters, digits and "-._~", writes all other
+ *     escapes in uppercase, and escapes spaces, control characters and
+ *     bytes beyond ASCII (and a '%' that doesn't begin an escape);
+ *   - removes "." and ".." segments, turns an empty path into "/" and
+ *     drops a '/' ending any longer path;
+ *   - drops utm_* and other tracking parameters from the query, and then
+ *     the query itself if that leaves it empty;
+ *   - drops the fragment.
+ *
+ *     "HTTP://News.Example.COM:80/a/./b/?utm_source=rss&id=7#top"
+ *         -> "http://news.example.com/a/b?id=7"
+ *
+ * The result is a key for recognizing the same page, and a server may
+ * answer it differently than the original (that trailing '/' may matter
+ * to it), so fetch the original.  Returns false if v has no scheme or no
+ * server, or if buffer is too small; 3 * v->textLength + 2 characters
+ * always suffice.
+ */
+
+bool URLCanonicalize(urlview *u, const urlview *v, char buffer[], size_t bufferLength);
+
+/**
+ * Function: URLFingerprint
+ * Usage: if (FingerprintSetEnter(&seen, URLFingerprint(&link))) ...
+ * ------------------------
+ * Returns a 64-bit hash of the canonical form of v (see URLCanonicalize),
+ * so that two URLs get the same fingerprint when they canonicalize the
+ * same, and different ones, save for a 1 in 2^64 chance, when they don't.
+ * A URL that can't be canonicalized (a relative one) is hashed as written.
+ * Fingerprints are stable from run to run, so they can be saved.
+ */
+
+uint64_t URLFingerprint(const urlview *v);
+
+/**
+ * Function: URLDefaultPort
+ * Usage: int port = URLDefaultPort("https", 5);
+ * ------------------------
+ * Returns the port a server conventionally listens to for the given
+ * scheme (compared without regard to case), such as 80 for "http", 443
+ * for "https" and 21 for "ftp", or 0 if the scheme isn't a known one.
+ */
+
+int URLDefaultPort(const char *scheme, int length);
+
+/**
+ * Function: URLViewDispose
+ * Usage: URLViewDispose(&link);
+ * -----------------------------
+ * Frees the copy of the text owned by the specified urlview, if there is
+ * one.
+ */
+
+void URLViewDispose(urlview *u);
+
 #endif
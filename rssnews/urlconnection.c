@@ -1,25 +1,81 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
 #include <assert.h>
+#include <pthread.h>
 #include "urlconnection.h"
 #include "url.h"
+#include "bool.h"
+#include "charset.h"
 #include <curl/curl.h>
 
 #define DEBUG_URLCONN 0
 
+/**
+ * The body is downloaded into a buffer that grows geometrically, so a
+ * document of n bytes costs O(log n) reallocs however finely curl chops
+ * it up.  Better still, when the server says how long the document is
+ * (in a Content-Length header, which curl hands to HeaderCallback before
+ * any of the body arrives), the buffer is made exactly that big the
+ * first time it has to grow.  A Content-Length beyond kMaxPresize isn't
+ * trusted that far, and the buffer grows towards it the usual way.
+ */
+
+static const size_t kMinBodyCapacity = 16 * 1024;
+static const size_t kMaxPresize = 64 * 1024 * 1024;
+
 struct MemoryStruct {
   char *memory;
   size_t size;
+  size_t capacity;
+  size_t expected;    // the Content-Length, or 0 if the server didn't give one
 };
 
+static size_t HeaderCallback(void *contents, size_t size, size_t nitems, void *userp)
+{
+  size_t length = size * nitems;
+  const char *buffer = contents;
+  struct MemoryStruct *mem = (struct MemoryStruct *)userp;
+
+  static const char kContentLength[] = "content-length:";
+  size_t prefix = strlen(kContentLength);
+  if (length > prefix && strncasecmp(buffer, kContentLength, prefix) == 0) {
+    size_t i = prefix, expected = 0;
+    while (i < length && (buffer[i] == ' ' || buffer[i] == '\t')) i++;
+    while (i < length && buffer[i] >= '0' && buffer[i] <= '9' && expected <= kMaxPresize)
+      expected = 10 * expected + (buffer[i++] - '0');
+    mem->expected = expected;
+  }
+  return length;
+}
+
+// makes room for at least needed bytes, or returns false if there's no memory for them
+static bool Reserve(struct MemoryStruct *mem, size_t needed)
+{
+  if (needed <= mem->capacity) return true;
+
+  size_t capacity;
+  if (mem->expected >= needed && mem->expected <= kMaxPresize) {
+    capacity = mem->expected + 1;
+  } else {
+    capacity = (2 * mem->capacity > kMinBodyCapacity) ? 2 * mem->capacity : kMinBodyCapacity;
+    if (capacity < needed) capacity = needed;
+  }
+
+  char *memory = realloc(mem->memory, capacity);
+  if (memory == NULL) return false;
+  mem->memory = memory;
+  mem->capacity = capacity;
+  return true;
+}
+
 static size_t WriteMemoryCallback(void *contents, size_t size, size_t nmemb, void *userp)
 { 
   size_t realsize = size * nmemb;
   struct MemoryStruct *mem = (struct MemoryStruct *)userp;
   
-  mem->memory = realloc(mem->memory, mem->size + realsize + 1);
-  if(mem->memory == NULL) {
+  if (!Reserve(mem, mem->size + realsize + 1)) {
     /* out of memory! */ 
     if (DEBUG_URLCONN) printf("not enough memory (realloc returned NULL)\n");
     return 0;
@@ -27,11 +83,93 @@ static size_t WriteMemoryCallback(void *contents, size_t size, size_t nmemb, voi
   
   memcpy(&(mem->memory[mem->size]), contents, realsize);
   mem->size += realsize; 
-  mem->memory[mem->size] = EOF;
+  mem->memory[mem->size] = '\0';
   
   return realsize;
 }
 
+/**
+ * The buffer pool is a stack, so the buffer handed out next is the one
+ * most recently given back, and the likeliest to still be in cache.
+ */
+
+static const size_t kMaxPooledCapacity = 8 * 1024 * 1024;
+
+struct PooledBuffer {
+  char *memory;
+  size_t capacity;
+};
+
+static pthread_mutex_t poolLock = PTHREAD_MUTEX_INITIALIZER;
+static struct PooledBuffer *pool = NULL;
+static int poolCount = 0;
+static int poolLimit = 0;
+
+// hands mem the most recently pooled buffer, if there is one
+static void TakePooledBuffer(struct MemoryStruct *mem)
+{
+  pthread_mutex_lock(&poolLock);
+  if (poolCount > 0) {
+    poolCount--;
+    mem->memory = pool[poolCount].memory;
+    mem->capacity = pool[poolCount].capacity;
+  }
+  pthread_mutex_unlock(&poolLock);
+}
+
+// pools the buffer if there's room for it, and frees it otherwise
+static void GiveBackBuffer(char *memory, size_t capacity)
+{
+  pthread_mutex_lock(&poolLock);
+  if (poolCount < poolLimit && capacity <= kMaxPooledCapacity) {
+    pool[poolCount].memory = memory;
+    pool[poolCount].capacity = capacity;
+    poolCount++;
+    memory = NULL;
+  }
+  pthread_mutex_unlock(&poolLock);
+  free(memory);
+}
+
+struct StreamingSink {
+  URLDataFunction datafn;
+  void *auxData;
+};
+
+static size_t WriteStreamingCallback(void *contents, size_t size, size_t nmemb, void *userp)
+{
+  size_t realsize = size * nmemb;
+  struct StreamingSink *sink = (struct StreamingSink *)userp;
+
+  sink->datafn(contents, realsize, sink->auxData);
+  return realsize;
+}
+
+/**
+ * Returns true if a document of the given content type is text, and so
+ * should be converted to UTF-8: any text/ type, anything XML, HTML or
+ * JSON, and (since most servers that leave it out are serving pages)
+ * a document with no content type at all.
+ */
+
+static bool IsTextContent(const char *contentType)
+{
+  if (contentType == NULL) return true;
+  if (strncasecmp(contentType, "text/", 5) == 0) return true;
+
+  const char *end = strchr(contentType, ';');
+  if (end == NULL) end = contentType + strlen(contentType);
+  static const char *const kTextSubtypes[] = { "xml", "html", "json" };
+  for (size_t i = 0; i < sizeof(kTextSubtypes) / sizeof(kTextSubtypes[0]); i++) {
+    size_t length = strlen(kTextSubtypes[i]);
+    if ((size_t) (end - contentType) >= length && strncasecmp(end - length, kTextSubtypes[i], length) == 0)
+      return true;
+  }
+  return false;
+}
+
+typedef size_t (*WriteCallback)(void *contents, size_t size, size_t nmemb, void *userp);
+
 void URLInitialise()
 {
   CURLcode res;
@@ -46,44 +184,51 @@ void URLInitialise()
 
 void URLCleanup()
 {
+  URLEnableBufferPool(0);
   curl_global_cleanup();
 }
 
-void URLConnectionNew(urlconnection* urlconn, const url* u)
+void URLEnableBufferPool(int maxBuffers)
 {
-  assert(urlconn != NULL);
-  assert(u != NULL);
-
-  if (DEBUG_URLCONN) printf("URLConnectionNew - entered\n");
+  assert(maxBuffers >= 0);
+
+  pthread_mutex_lock(&poolLock);
+  while (poolCount > maxBuffers) free(pool[--poolCount].memory);
+  pool = realloc(pool, maxBuffers * sizeof(struct PooledBuffer));
+  assert(pool != NULL || maxBuffers == 0);
+  poolLimit = maxBuffers;
+  pthread_mutex_unlock(&poolLock);
+}
 
-  struct MemoryStruct chunk;
+/**
+ * Does everything URLConnectionNew and URLConnectionNewStreaming have in
+ * common: fetches the document addressed by u, handing the body to
+ * writefn as curl receives it (and each header line to headerfn, unless
+ * it's NULL), and fills in every field of urlconn but the dataStream and
+ * body.  Returns true if the transfer succeeded.
+ */
 
-  chunk.memory = malloc(1);	// will be grown as needed by the realloc above 
-  chunk.size = 0;		// no data at this point
+static bool URLConnectionFetch(urlconnection* urlconn, const url* u, WriteCallback writefn,
+                               WriteCallback headerfn, void *writeData)
+{
+  bool succeeded = false;
 
   urlconn->responseCode = 0;
+  urlconn->dataStream = NULL;
+  urlconn->body = NULL;
+  urlconn->bodyLength = 0;
+  urlconn->bodyCapacity = 0;
 
-  // set up full url, allocate space, copy from url->fullName and port
-  // make sure we cater for the https:// (8 chars) or http:// (7 chars)
+  // set up full url, allocate space, copy from url->scheme and url->fullName
+  // (http:// or https://, or whatever the scheme happens to be)
 
-  int urllength = 0;
-
-  if (u->port == 80) {
-    urllength = strlen(u->fullName) + 7;
-  } else {
-    urllength = strlen(u->fullName) + 8;
-  }
+  int urllength = strlen(u->scheme) + strlen("://") + strlen(u->fullName);
 
   urlconn->fullUrl = (void *) malloc(urllength + 1);
 
   assert(urlconn->fullUrl != NULL);
   
-  if (u->port == 80) 
-    strcpy((void *)urlconn->fullUrl, "http://");
-  else
-    strcpy((void *)urlconn->fullUrl, "https://");
-
-  strncat((char *)urlconn->fullUrl, u->fullName, urllength - strlen(urlconn->fullUrl));
+  sprintf((char *)urlconn->fullUrl, "%s://%s", u->scheme, u->fullName);
 
   // create responseMessage string to be max ERROR size and set it to be empty
   urlconn->responseMessage = (char*) malloc(CURL_ERROR_SIZE);
@@ -99,10 +244,14 @@ void URLConnectionNew(urlconnection* urlconn, const url* u)
   if (DEBUG_URLCONN) printf("curl_easy_setopt for urlconn: %s\n",urlconn->fullUrl);
  
   // send all data to this function
-  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
+  curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writefn);
 
-  // we pass our 'chunk' struct to the callback function */
-  curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *)&chunk);
+  // along with whatever state it needs
+  curl_easy_setopt(curl, CURLOPT_WRITEDATA, writeData);
+  if (headerfn != NULL) {
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, headerfn);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, writeData);
+  }
 
   // some servers don't like requests that are made without a user-agent
   // field, so we provide one
@@ -125,35 +274,12 @@ void URLConnectionNew(urlconnection* urlconn, const url* u)
 
   } else {
     if (DEBUG_URLCONN) printf("Yah!! curl passed\n");
-    
-    /*
-     * Now, our chunk.memory points to a memory block that is chunk.size
-     * bytes big and contains the remote file.
-     *
-     * Do something nice with it!
-     */
-    if (DEBUG_URLCONN) printf("chunk address of size %zu is located at %p\n",chunk.size,(void *)chunk.memory);
+    succeeded = true;
 
     strcpy((void *)urlconn->responseMessage, "OK!");
 
     if (DEBUG_URLCONN) printf("current responseMessage is: %s and size of %lu\n",urlconn->responseMessage,strlen(urlconn->responseMessage));
 
-    if (DEBUG_URLCONN) printf("assigning memory to urlconn->datastream of %lu bytes\n",(unsigned long)chunk.size); 
-
-    char *buf = NULL;
-    urlconn->dataStream = fmemopen (buf, chunk.size + 1, "w+");
-    assert(urlconn->dataStream != NULL);
-
-    for (int i = 0; i < chunk.size; i++) {
-      char ch = chunk.memory[i];
-      fputc(ch, urlconn->dataStream);
-    } 
-    if (DEBUG_URLCONN) printf("created dataStream\n");
-    rewind(urlconn->dataStream);
-
-    chunk.size = 0;
-    free(chunk.memory);
-
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &(urlconn->responseCode));
 
     // set content type
@@ -201,6 +327,65 @@ void URLConnectionNew(urlconnection* urlconn, const url* u)
   if (DEBUG_URLCONN) printf("Cleaning up curl\n");
   curl_easy_cleanup(curl);
   if (DEBUG_URLCONN) printf("Cleaned up curl\n");
+  return succeeded;
+}
+
+void URLConnectionNew(urlconnection* urlconn, const url* u)
+{
+  assert(urlconn != NULL);
+  assert(u != NULL);
+
+  if (DEBUG_URLCONN) printf("URLConnectionNew - entered\n");
+
+  struct MemoryStruct chunk;
+
+  chunk.memory = NULL;		// will be grown as needed by Reserve above
+  chunk.capacity = 0;
+  chunk.size = 0;		// no data at this point
+  chunk.expected = 0;
+  TakePooledBuffer(&chunk);	// unless the pool has a buffer to start with
+
+  if (URLConnectionFetch(urlconn, u, WriteMemoryCallback, HeaderCallback, &chunk) && Reserve(&chunk, 1)) {
+    /*
+     * Now, our chunk.memory points to a memory block that is chunk.size
+     * bytes big and contains the remote file.
+     *
+     * Do something nice with it!
+     */
+    if (IsTextContent(urlconn->contentType)) {
+      char *original = chunk.memory;
+      chunk.size = ConvertToUTF8(&chunk.memory, chunk.size, urlconn->contentType);
+      if (chunk.memory != original) chunk.capacity = chunk.size + 1;
+    }
+    chunk.memory[chunk.size] = '\0';   // ConvertToUTF8 may have moved the rest down over a BOM
+
+    if (DEBUG_URLCONN) printf("chunk address of size %zu is located at %p\n",chunk.size,(void *)chunk.memory);
+
+    // the connection keeps the body, and the dataStream reads it where it lies
+    urlconn->body = chunk.memory;
+    urlconn->bodyLength = chunk.size;
+    urlconn->bodyCapacity = chunk.capacity;
+    urlconn->dataStream = fmemopen(chunk.memory, chunk.size, "r");
+    assert(urlconn->dataStream != NULL);
+    if (DEBUG_URLCONN) printf("created dataStream\n");
+  } else if (chunk.memory != NULL) {
+    GiveBackBuffer(chunk.memory, chunk.capacity);
+  }
+}
+
+void URLConnectionNewStreaming(urlconnection* urlconn, const url* u, URLDataFunction datafn, void *auxData)
+{
+  assert(urlconn != NULL);
+  assert(u != NULL);
+  assert(datafn != NULL);
+
+  if (DEBUG_URLCONN) printf("URLConnectionNewStreaming - entered\n");
+
+  struct StreamingSink sink;
+  sink.datafn = datafn;
+  sink.auxData = auxData;
+
+  URLConnectionFetch(urlconn, u, WriteStreamingCallback, NULL, &sink);
 }
 
 void URLConnectionDispose(urlconnection* urlconn)
@@ -224,7 +409,9 @@ void URLConnectionDispose(urlconnection* urlconn)
   }
 */
   if (DEBUG_URLCONN) printf(" .. closing dataStream\n");
-  if (urlconn->responseCode != 0)
+  if (urlconn->responseCode != 0 && urlconn->dataStream != NULL)
     fclose(urlconn->dataStream);
+  if (urlconn->body != NULL)
+    GiveBackBuffer((char *)urlconn->body, urlconn->bodyCapacity);
   if (DEBUG_URLCONN) printf("freed up URL Connection\n");
 }
@@ -10,8 +10,9 @@
  * The record is exposed, but the client should respect
  * the integrity of the first five fields and not change
  * them.  The client may certainly read data from the last
- * field, but the client should not set dataStream to point
- * to anything else, and it should *never* fclose the file.
+ * three fields, but the client should not set dataStream to point
+ * to anything else, it should *never* fclose the file, and
+ * it should never free or write to the body.
  */
 
 #ifndef __url_connection_
@@ -38,6 +39,9 @@ typedef struct {
   const char *fullUrl;
   const char *newUrl;
   FILE *dataStream;
+  const char *body;
+  size_t bodyLength;
+  size_t bodyCapacity;    // private: the bytes allocated for the body
 } urlconnection;
 
 /**
@@ -61,6 +65,23 @@ void URLInitialise();
 
 void URLCleanup();
 
+/**
+ * Function: URLEnableBufferPool
+ * Usage: URLEnableBufferPool(8);
+ * -----------------------------
+ * Keeps the memory of up to maxBuffers disposed bodies around, rather
+ * than freeing it, for later URLConnectionNew calls to download into.
+ * A crawler fetching document after document then reuses memory that's
+ * already been touched, instead of asking malloc (and, for bodies of a
+ * few hundred kilobytes or more, the kernel) for fresh pages every time.
+ * Bodies bigger than a few megabytes are freed regardless.  The pool is
+ * shared by all threads, and is off (maxBuffers is 0) until this is
+ * called; passing 0 turns it back off.  URLCleanup frees whatever the
+ * pool is holding.
+ */
+
+void URLEnableBufferPool(int maxBuffers);
+
 /**
  * Function: URLConnectionNew
  * --------------------------
@@ -101,17 +122,54 @@ void URLCleanup();
  *      dataStream: Used to read in the content of the remote HTTP document.  The FILE * is normally used to read
  *                  data from a local file, but the magic of UNIX allows us to layer local file access semantics over
  *                  a network connection and to pull in remote data as if it were local.
+ *                  Text documents (HTML, XML feeds and the like) arrive in UTF-8, whatever
+ *                  character set the server sent them in: see ConvertToUTF8 in charset.h.
+ *
+ *      body, bodyLength: The very bytes the dataStream reads, bodyLength of them, followed by a '\0'
+ *                  that isn't counted.  The body belongs to the urlconnection and lives until
+ *                  URLConnectionDispose, and the dataStream is opened read-only over it rather than
+ *                  over a copy, so a client that can work from memory (STNewFromBuffer, say) can
+ *                  skip the dataStream altogether.  NULL and 0 if the fetch failed.
  *      
  */
 
 void URLConnectionNew(urlconnection* urlconn, const url* u);
 
+/**
+ * Type: URLDataFunction
+ * ---------------------
+ * Class of function that receives the body of a document fetched by
+ * URLConnectionNewStreaming, one chunk at a time and in order, as it
+ * arrives over the network.  The length bytes at the specified address
+ * are only valid for the duration of the call.
+ */
+
+typedef void (*URLDataFunction)(const char *bytes, size_t length, void *auxData);
+
+/**
+ * Function: URLConnectionNewStreaming
+ * -----------------------------------
+ * Behaves like URLConnectionNew, except that rather than buffering the
+ * whole document and exposing it through the dataStream, it passes each
+ * chunk of the body to datafn (along with auxData) the moment curl receives
+ * it, and leaves dataStream set to NULL.  That allows a client to process
+ * a document (for instance, by feeding a streamtokenizer created with
+ * STNewPush) while the rest of it is still downloading.  The chunks are
+ * passed on exactly as they arrive, without any conversion to UTF-8, and
+ * the body is left NULL, with a bodyLength of 0.  The remaining
+ * fields are populated just as URLConnectionNew populates them, once the
+ * transfer is over.
+ */
+
+void URLConnectionNewStreaming(urlconnection* urlconn, const url* u, URLDataFunction datafn, void *auxData);
+
 /**
  * Function: URLConnection
  * -----------------------
  * Accepts the address of a previously initialized
  * urlconnection, closes the connection to the relevant
- * server, and releases all dynamically allocated strings.
+ * server, and releases all dynamically allocated strings,
+ * along with the body.
  */
  
 void URLConnectionDispose(urlconnection* urlconn);
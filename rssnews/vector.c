@@ -62,11 +62,34 @@ void VectorReplace(vector *v, const void *elemAddr, int position)
 	memcpy(target, elemAddr, v->elemSize);
 }
 
+void VectorClear(vector *v, bool disposeElements)
+{
+	assert(v != NULL);
+
+	if (disposeElements && v->freeFn != NULL) {
+		for (int i = 0; i < v->logicalLength; i++) {
+			void *target = (char *)v->elems + (i * v->elemSize);
+			v->freeFn(target);
+		}
+	}
+	v->logicalLength = 0;
+}
+
 void VectorGrow(vector *v) {
 	v->allocatedLength += v->allocationChunk;
 	v->elems = realloc(v->elems, v->allocatedLength * v->elemSize);
 }
 
+void VectorReserve(vector *v, int capacity)
+{
+	assert(v != NULL);
+
+	if (capacity <= v->allocatedLength) return;
+	v->allocatedLength = capacity;
+	v->elems = realloc(v->elems, v->allocatedLength * v->elemSize);
+	assert(v->elems != NULL);
+}
+
 void VectorInsert(vector *v, const void *elemAddr, int position)
 {
 	assert((v != NULL) && (elemAddr != NULL) && (position >=0 ) && (position <= v->logicalLength));
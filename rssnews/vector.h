@@ -168,6 +168,31 @@ int VectorLength(const vector *v);
 
 void *VectorNth(const vector *v, int position);
 					  
+/**
+ * Function: VectorClear
+ * ---------------------
+ * Removes every element from the vector, leaving its logical length at zero
+ * but keeping its allocation for reuse.  If disposeElements is true, the
+ * VectorFreeFunction supplied to VectorNew is applied to each element first,
+ * just as VectorDispose would.  Pass false when the elements have been copied
+ * by value somewhere else (into another container, say) and the resources
+ * they reference now belong to that copy.
+ */
+
+void VectorClear(vector *v, bool disposeElements);
+
+/**
+ * Function: VectorReserve
+ * -----------------------
+ * Makes sure the vector has room for at least capacity elements, so that
+ * it can grow to that length without any further reallocation.  Useful
+ * when the client knows a large number of appends is on the way, since the
+ * vector otherwise grows by only initialAllocation elements at a time.
+ * Never shrinks the vector.
+ */
+
+void VectorReserve(vector *v, int capacity);
+
 /**
  * Function: VectorInsert
  * ----------------------
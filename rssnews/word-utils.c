@@ -0,0 +1,402 @@
+#include "word-utils.h"
+#include "streamtokenizer.h"
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+
+/**
+ * The stop words are stored in a perfect hash built with the "hash and
+ * displace" method.  Each word first hashes (with seed 0) to one of 64
+ * buckets, and the bucket's entry in kStopWordSeeds gives the seed under
+ * which every word in that bucket hashes to its own slot in kStopWords.
+ * The seeds were found offline by trying each one in turn, largest bucket
+ * first, until the bucket's words landed in distinct, unused slots.  Any
+ * word that isn't a stop word still lands in some slot, and the string
+ * comparison against whatever is stored there rejects it.
+ */
+
+static const unsigned short kStopWordSeeds[64] = {
+  5, 7, 0, 4, 1, 0, 10, 2, 1, 1, 2, 2,
+  1, 1, 2, 3, 4, 12, 9, 2, 2, 1, 1, 3,
+  15, 5, 2, 1, 2, 6, 9, 1, 6, 2, 1, 3,
+  1, 14, 2, 2, 19, 2, 2, 4, 2, 1, 0, 4,
+  4, 16, 5, 0, 0, 9, 3, 4, 0, 5, 4, 9,
+  10, 1, 4, 5
+};
+
+static const char *const kStopWords[256] = {
+  NULL, NULL, "have", "in", NULL, NULL,
+  "has", "ourselves", NULL, NULL, "having", "these",
+  NULL, "couldn't", "any", "we've", "down", NULL,
+  "this", "between", NULL, "i've", NULL, "he'll",
+  "while", "then", "why", "what", "itself", "he",
+  "again", "yourselves", "myself", "me", "they've", NULL,
+  "as", "she's", "were", NULL, "than", "i'd",
+  NULL, "further", NULL, "am", "i'm", "we",
+  "and", "here", "how", NULL, "does", NULL,
+  "more", NULL, NULL, "you're", "don't", "she",
+  "you'd", "was", "where's", NULL, NULL, NULL,
+  "do", "doing", "should", "when's", "yourself", "weren't",
+  "shouldn't", "they'd", "before", NULL, "he's", "which",
+  "him", NULL, "we'll", "nor", "a", NULL,
+  "your", NULL, "no", "i", "into", "their",
+  "how's", "such", "cannot", "would", "our", NULL,
+  "them", "some", "let's", "it's", "here's", NULL,
+  NULL, "of", "herself", NULL, NULL, NULL,
+  NULL, NULL, NULL, "most", "own", NULL,
+  NULL, NULL, "an", NULL, "until", "he'd",
+  "that's", "or", NULL, "against", NULL, NULL,
+  NULL, NULL, "so", NULL, "ought", NULL,
+  "yours", "can't", "that", NULL, NULL, "hadn't",
+  "same", "mustn't", NULL, NULL, "after", "why's",
+  "because", "at", NULL, "her", "from", "didn't",
+  "are", "been", NULL, NULL, NULL, "we're",
+  "over", "his", NULL, "all", "hers", "what's",
+  "the", NULL, "for", "my", "theirs", NULL,
+  "aren't", "had", NULL, NULL, "is", NULL,
+  "you", "with", "whom", "during", "by", "both",
+  "we'd", "she'd", NULL, "doesn't", "when", NULL,
+  "its", "very", NULL, "hasn't", NULL, NULL,
+  "those", "they're", NULL, "but", NULL, "who's",
+  "few", NULL, "not", NULL, "about", "each",
+  "on", "himself", "you'll", NULL, "shan't", "there's",
+  "could", "they'll", "off", "below", NULL, "themselves",
+  NULL, "be", "who", "only", "if", "once",
+  "other", NULL, NULL, "isn't", "under", "wouldn't",
+  "it", NULL, "they", "won't", "out", "wasn't",
+  NULL, "being", "above", "to", "through", NULL,
+  NULL, "where", "did", "she'll", "you've", "too",
+  "up", NULL, NULL, NULL, "ours", "there",
+  "i'll", NULL, NULL, "haven't"
+};
+
+static const int kNumStopWordBuckets = sizeof(kStopWordSeeds) / sizeof(kStopWordSeeds[0]);
+static const int kNumStopWordSlots = sizeof(kStopWords) / sizeof(kStopWords[0]);
+
+// 32-bit FNV-1a, with the seed folded into the offset basis
+static uint32_t HashWord(const char *word, int length, uint32_t seed)
+{
+  uint32_t hash = 2166136261u ^ seed;
+  for (int i = 0; i < length; i++) {
+    hash ^= (unsigned char) word[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+bool IsStopWord(const char *word, int length)
+{
+  assert(word != NULL && length >= 0);
+
+  uint32_t seed = kStopWordSeeds[HashWord(word, length, 0) % kNumStopWordBuckets];
+  const char *candidate = kStopWords[HashWord(word, length, seed) % kNumStopWordSlots];
+  return candidate != NULL && strncmp(candidate, word, length) == 0 && candidate[length] == '\0';
+}
+
+/**
+ * The stemmer is a transcription of Martin Porter's own C implementation
+ * of his algorithm, including the three departures he made from the
+ * published paper ("bli" -> "ble", "logi" -> "log", and the extra
+ * conditions in step 1ab), with its globals gathered into a struct so that
+ * any number of threads can stem at once.  b holds the word, k indexes its
+ * last character, and j marks the end of the stem left by the last
+ * successful Ends.
+ */
+
+typedef struct {
+  char *b;
+  int k;
+  int j;
+} stemmer;
+
+// is b[i] a consonant?
+static bool IsConsonant(const stemmer *z, int i)
+{
+  switch (z->b[i]) {
+    case 'a': case 'e': case 'i': case 'o': case 'u': return false;
+    case 'y': return (i == 0) ? true : !IsConsonant(z, i - 1);
+    default: return true;
+  }
+}
+
+/**
+ * Counts the consonant-vowel sequences in b[0..j].  Writing c for a run of
+ * consonants and v for a run of vowels, every word is [c](vc)^m[v], and
+ * this returns m: "tr" and "ee" give 0, "trouble" gives 1, "private" 2.
+ */
+
+static int Measure(const stemmer *z)
+{
+  int n = 0;
+  int i = 0;
+
+  while (true) {
+    if (i > z->j) return n;
+    if (!IsConsonant(z, i)) break;
+    i++;
+  }
+  i++;
+
+  while (true) {
+    while (true) {
+      if (i > z->j) return n;
+      if (IsConsonant(z, i)) break;
+      i++;
+    }
+    i++;
+    n++;
+    while (true) {
+      if (i > z->j) return n;
+      if (!IsConsonant(z, i)) break;
+      i++;
+    }
+    i++;
+  }
+}
+
+// does b[0..j] contain a vowel?
+static bool VowelInStem(const stemmer *z)
+{
+  for (int i = 0; i <= z->j; i++)
+    if (!IsConsonant(z, i)) return true;
+  return false;
+}
+
+// does b[i-1..i] hold a double consonant?
+static bool DoubleConsonant(const stemmer *z, int i)
+{
+  return i >= 1 && z->b[i] == z->b[i - 1] && IsConsonant(z, i);
+}
+
+/**
+ * Does b[i-2..i] run consonant-vowel-consonant, with the last consonant
+ * something other than w, x or y?  That's the shape of the short words
+ * ("cav(e)", "lov(e)", "hop(e)") that get an e restored in steps 1 and 5.
+ */
+
+static bool ConsonantVowelConsonant(const stemmer *z, int i)
+{
+  if (i < 2 || !IsConsonant(z, i) || IsConsonant(z, i - 1) || !IsConsonant(z, i - 2)) return false;
+  char ch = z->b[i];
+  return ch != 'w' && ch != 'x' && ch != 'y';
+}
+
+// does b[0..k] end in suffix?  If so, j is left just before it
+static bool Ends(stemmer *z, const char *suffix)
+{
+  if (suffix[0] == '\0' || z->b[z->k] != suffix[strlen(suffix) - 1]) return false;
+  int length = strlen(suffix);
+  if (length > z->k + 1) return false;
+  if (memcmp(z->b + z->k - length + 1, suffix, length) != 0) return false;
+  z->j = z->k - length;
+  return true;
+}
+
+// replaces b[j+1..k] with replacement, adjusting k
+static void SetTo(stemmer *z, const char *replacement)
+{
+  int length = strlen(replacement);
+  memmove(z->b + z->j + 1, replacement, length);
+  z->k = z->j + length;
+}
+
+static void ReplaceIfMeasured(stemmer *z, const char *replacement)
+{
+  if (Measure(z) > 0) SetTo(z, replacement);
+}
+
+// removes plurals and -ed or -ing: caresses -> caress, ponies -> poni, meetings -> meet
+static void Step1ab(stemmer *z)
+{
+  if (z->b[z->k] == 's') {
+    if (Ends(z, "sses"))
+      z->k -= 2;
+    else if (Ends(z, "ies"))
+      SetTo(z, "i");
+    else if (z->b[z->k - 1] != 's')
+      z->k--;
+  }
+
+  if (Ends(z, "eed")) {
+    if (Measure(z) > 0) z->k--;
+  } else if ((Ends(z, "ed") || Ends(z, "ing")) && VowelInStem(z)) {
+    z->k = z->j;
+    if (Ends(z, "at"))
+      SetTo(z, "ate");
+    else if (Ends(z, "bl"))
+      SetTo(z, "ble");
+    else if (Ends(z, "iz"))
+      SetTo(z, "ize");
+    else if (DoubleConsonant(z, z->k)) {
+      z->k--;
+      char ch = z->b[z->k];
+      if (ch == 'l' || ch == 's' || ch == 'z') z->k++;
+    } else if (Measure(z) == 1 && ConsonantVowelConsonant(z, z->k)) {
+      z->j = z->k;
+      SetTo(z, "e");
+    }
+  }
+}
+
+// turns a terminal y into i when there's another vowel in the stem
+static void Step1c(stemmer *z)
+{
+  if (Ends(z, "y") && VowelInStem(z)) z->b[z->k] = 'i';
+}
+
+/**
+ * Each of steps 2 through 4 tries a table of suffixes, grouped by the
+ * penultimate (or, for step 3, final) letter just as Porter's switch
+ * statements group them, and applies the first that matches.
+ */
+
+typedef struct {
+  const char *suffix;
+  const char *replacement;
+} suffixrule;
+
+static bool ApplyRules(stemmer *z, const suffixrule rules[])
+{
+  for (int i = 0; rules[i].suffix != NULL; i++) {
+    if (Ends(z, rules[i].suffix)) {
+      ReplaceIfMeasured(z, rules[i].replacement);
+      return true;
+    }
+  }
+  return false;
+}
+
+// maps double suffixes to single ones: -ization -> -ize, -ational -> -ate
+static void Step2(stemmer *z)
+{
+  static const suffixrule a[] = {{"ational", "ate"}, {"tional", "tion"}, {NULL, NULL}};
+  static const suffixrule c[] = {{"enci", "ence"}, {"anci", "ance"}, {NULL, NULL}};
+  static const suffixrule e[] = {{"izer", "ize"}, {NULL, NULL}};
+  static const suffixrule l[] = {{"bli", "ble"}, {"alli", "al"}, {"entli", "ent"}, {"eli", "e"},
+                                 {"ousli", "ous"}, {NULL, NULL}};
+  static const suffixrule o[] = {{"ization", "ize"}, {"ation", "ate"}, {"ator", "ate"}, {NULL, NULL}};
+  static const suffixrule s[] = {{"alism", "al"}, {"iveness", "ive"}, {"fulness", "ful"},
+                                 {"ousness", "ous"}, {NULL, NULL}};
+  static const suffixrule t[] = {{"aliti", "al"}, {"iviti", "ive"}, {"biliti", "ble"}, {NULL, NULL}};
+  static const suffixrule g[] = {{"logi", "log"}, {NULL, NULL}};
+
+  switch (z->b[z->k - 1]) {
+    case 'a': ApplyRules(z, a); break;
+    case 'c': ApplyRules(z, c); break;
+    case 'e': ApplyRules(z, e); break;
+    case 'l': ApplyRules(z, l); break;
+    case 'o': ApplyRules(z, o); break;
+    case 's': ApplyRules(z, s); break;
+    case 't': ApplyRules(z, t); break;
+    case 'g': ApplyRules(z, g); break;
+  }
+}
+
+// deals with -ic-, -full, -ness and the like
+static void Step3(stemmer *z)
+{
+  static const suffixrule e[] = {{"icate", "ic"}, {"ative", ""}, {"alize", "al"}, {NULL, NULL}};
+  static const suffixrule i[] = {{"iciti", "ic"}, {NULL, NULL}};
+  static const suffixrule l[] = {{"ical", "ic"}, {"ful", ""}, {NULL, NULL}};
+  static const suffixrule s[] = {{"ness", ""}, {NULL, NULL}};
+
+  switch (z->b[z->k]) {
+    case 'e': ApplyRules(z, e); break;
+    case 'i': ApplyRules(z, i); break;
+    case 'l': ApplyRules(z, l); break;
+    case 's': ApplyRules(z, s); break;
+  }
+}
+
+// takes off -ant, -ence and the like, in context <c>vcvc<v>
+static void Step4(stemmer *z)
+{
+  static const char *const a[] = {"al", NULL};
+  static const char *const c[] = {"ance", "ence", NULL};
+  static const char *const e[] = {"er", NULL};
+  static const char *const i[] = {"ic", NULL};
+  static const char *const l[] = {"able", "ible", NULL};
+  static const char *const n[] = {"ant", "ement", "ment", "ent", NULL};
+  static const char *const s[] = {"ism", NULL};
+  static const char *const t[] = {"ate", "iti", NULL};
+  static const char *const u[] = {"ous", NULL};
+  static const char *const v[] = {"ive", NULL};
+  static const char *const z4[] = {"ize", NULL};
+  const char *const *suffixes;
+
+  switch (z->b[z->k - 1]) {
+    case 'a': suffixes = a; break;
+    case 'c': suffixes = c; break;
+    case 'e': suffixes = e; break;
+    case 'i': suffixes = i; break;
+    case 'l': suffixes = l; break;
+    case 'n': suffixes = n; break;
+    case 'o':
+      // -ion only comes off after an s or a t
+      if (Ends(z, "ion") && z->j >= 0 && (z->b[z->j] == 's' || z->b[z->j] == 't')) break;
+      if (Ends(z, "ou")) break;
+      return;
+    case 's': suffixes = s; break;
+    case 't': suffixes = t; break;
+    case 'u': suffixes = u; break;
+    case 'v': suffixes = v; break;
+    case 'z': suffixes = z4; break;
+    default: return;
+  }
+
+  if (z->b[z->k - 1] != 'o') {
+    int n;
+    for (n = 0; suffixes[n] != NULL; n++)
+      if (Ends(z, suffixes[n])) break;
+    if (suffixes[n] == NULL) return;
+  }
+
+  if (Measure(z) > 1) z->k = z->j;
+}
+
+// removes a final -e when the measure allows it, and reduces -ll to -l
+static void Step5(stemmer *z)
+{
+  z->j = z->k;
+  if (z->b[z->k] == 'e') {
+    int m = Measure(z);
+    if (m > 1 || (m == 1 && !ConsonantVowelConsonant(z, z->k - 1))) z->k--;
+  }
+  if (z->b[z->k] == 'l' && DoubleConsonant(z, z->k) && Measure(z) > 1) z->k--;
+}
+
+int StemWord(char *word, int length)
+{
+  assert(word != NULL && length >= 0);
+
+  if (length < 3) return length;
+  for (int i = 0; i < length; i++)
+    if (word[i] < 'a' || word[i] > 'z') return length;
+
+  stemmer z = { word, length - 1, 0 };
+  Step1ab(&z);
+  if (z.k > 0) {
+    Step1c(&z);
+    Step2(&z);
+    Step3(&z);
+    Step4(&z);
+    Step5(&z);
+  }
+  return z.k + 1;
+}
+
+bool NormalizeWord(char *word, int *length, void *auxData)
+{
+  (void) auxData;
+  assert(word != NULL && length != NULL);
+
+  *length = STFoldCase(word, *length);
+  if (IsStopWord(word, *length)) {
+    word[*length] = '\0';
+    return false;
+  }
+
+  *length = StemWord(word, *length);
+  word[*length] = '\0';
+  return true;
+}
@@ -0,0 +1,61 @@
+#ifndef _wordutils_
+#define _wordutils_
+
+#include "bool.h"
+
+/* File: word-utils.h
+ * ------------------
+ * Defines the normalization applied to words before they're indexed:
+ * case folding, stop word rejection and stemming.  Indexing "Running",
+ * "runs" and "run" under the single key "run", and not indexing "the"
+ * at all, shrinks the vocabulary and the posting lists considerably, and
+ * lets a query for any one form match all of them.
+ *
+ * The pieces can be used separately, or all at once by installing
+ * NormalizeWord as a streamtokenizer's normalizer:
+ *
+ *     STNew(&st, infile, kTextDelimiters, true);
+ *     STSetNormalizer(&st, NormalizeWord, NULL);
+ *     while (STNextWord(&st, word, sizeof(word)))
+ *         IndexWord(word);   // already folded, stemmed and never a stop word
+ */
+
+/**
+ * Function: IsStopWord
+ * --------------------
+ * Returns true if and only if the length-character word is one of the
+ * 174 common English words (Snowball's English stop word list: "the",
+ * "of", "and", "don't" and so on) that carry too little meaning to be
+ * worth indexing.  The word must already be lowercase.  The list is
+ * compiled into a perfect hash, so a lookup costs one hash and at most
+ * one string comparison.
+ */
+
+bool IsStopWord(const char *word, int length);
+
+/**
+ * Function: StemWord
+ * ------------------
+ * Reduces the length-character lowercase English word to its stem in
+ * place, following Porter's stemming algorithm ("connections",
+ * "connected" and "connecting" all become "connect"), and returns the
+ * length of the stem.  The stem is not null-terminated unless the word
+ * was.  Words shorter than three characters, and words containing anything
+ * other than the letters a through z, are returned unchanged.
+ */
+
+int StemWord(char *word, int length);
+
+/**
+ * Function: NormalizeWord
+ * -----------------------
+ * Case folds (see STFoldCase), then rejects stop words, then stems the
+ * null-terminated word in place, updating *length and keeping the word
+ * null-terminated.  Returns false if the word is a stop word.  The
+ * signature matches STNormalizeFunction, so NormalizeWord can be passed
+ * directly to STSetNormalizer; auxData is ignored.
+ */
+
+bool NormalizeWord(char *word, int *length, void *auxData);
+
+#endif